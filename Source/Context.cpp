@@ -2,38 +2,42 @@
 // Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
 
 #include <Context.hpp>
-
-std::random_device Context::RNG{};
+#include <Random.hpp>
+#include <Profiler.hpp>
 
 Dimension Context::Width;
 Dimension Context::Height;
 
-#ifdef __APPLE__
-#include <mach-o/dyld.h>
-#endif
-
-Context::Context() {
-    SDLResultCheck(SDL_Init(SDL_INIT_AUDIO | SDL_INIT_VIDEO | SDL_INIT_EVENTS));
-    SDLResultCheck(IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG | IMG_INIT_TIF | IMG_INIT_WEBP | IMG_INIT_JXL | IMG_INIT_AVIF));
-    SDLResultCheck(Mix_OpenAudio(MIX_DEFAULT_FREQUENCY, MIX_DEFAULT_FORMAT, MIX_DEFAULT_CHANNELS, 4096));
+Context::Context(bool offscreen) : m_Archive(ResourceDirectory()) {
+    // Offscreen contexts render into a surface through the software renderer
+    // and need neither a display nor an audio device.
+    if(offscreen) {
+        SDLResultCheck(SDL_Init(SDL_INIT_EVENTS));
+        SDLResultCheck(IMG_Init(IMG_INIT_PNG));
 
-#ifdef __APPLE__
-    char path[PATH_MAX + 1] {};
-    uint32_t sz = sizeof(path);
-    _NSGetExecutablePath(path, &sz);
-    std::string cxxpath { path };
-    size_t pos = cxxpath.rfind('/');
-    std::string dir = cxxpath.substr(0, pos + 1);
-    m_ResourcePath = dir + "../Resources";
-#endif
+        SDL_Surface* target = SDL_CreateSurface(Width, Height, SDL_PIXELFORMAT_RGBA32);
+        SDLNullCheck(target);
+        m_Target.reset(target);
 
-    SDL_Window* window = SDL_CreateWindow(Title, Width, Height, SDL_WINDOW_BORDERLESS | SDL_WINDOW_OPENGL);
-    SDLNullCheck(window);
-    m_Window.reset(window);
+        SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(m_Target.get());
+        SDLNullCheck(renderer);
+        m_Renderer.reset(renderer);
+    }
+    else {
+        SDLResultCheck(SDL_Init(SDL_INIT_AUDIO | SDL_INIT_VIDEO | SDL_INIT_EVENTS));
+        SDLResultCheck(IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG | IMG_INIT_TIF | IMG_INIT_WEBP | IMG_INIT_JXL | IMG_INIT_AVIF));
+        SDLResultCheck(Mix_OpenAudio(MIX_DEFAULT_FREQUENCY, MIX_DEFAULT_FORMAT, MIX_DEFAULT_CHANNELS, 4096));
+
+        SDL_Window* window = SDL_CreateWindow(Title, Width, Height, SDL_WINDOW_BORDERLESS | SDL_WINDOW_OPENGL);
+        SDLNullCheck(window);
+        m_Window.reset(window);
+
+        SDL_Renderer* renderer = SDL_CreateRenderer(m_Window.get(), nullptr, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        SDLNullCheck(renderer);
+        m_Renderer.reset(renderer);
+    }
 
-    SDL_Renderer* renderer = SDL_CreateRenderer(m_Window.get(), nullptr, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-    SDLNullCheck(renderer);
-    m_Renderer.reset(renderer);
+    m_Atlas.Build(m_Renderer.get(), m_Archive);
 }
 
 Context::~Context() {
@@ -41,33 +45,30 @@ Context::~Context() {
     SDL_Quit();
 }
 
-float Context::SignedRandRange(float range) {
-    return ((static_cast<float>(RNG()) / static_cast<float>(std::random_device::max())) * (2 * range)) - range;
-}
-
-Dimension Context::SignedRandRange(Dimension range) {
-    return static_cast<Dimension>(((static_cast<float>(RNG()) / static_cast<float>(std::random_device::max())) * static_cast<float>(2 * range)) - static_cast<float>(range));
-}
-
-Dimension Context::UnsignedRandRange(Dimension range) {
-    float mul = static_cast<float>(RNG()) / static_cast<float>(std::random_device::max());
-    return static_cast<Dimension>(mul * static_cast<float>(range));
-}
-
 bool Context::Update() {
-    if(m_ShakeIntensity) m_ShakeIntensity -= UnsignedRandRange(2);
-    if(m_ShakeIntensity <= 0) m_ShakeIntensity = 0;
+    m_FrameArena.Reset();
 
-    SDL_RenderPresent(m_Renderer.get());
+    {
+        CWG_PROFILE("Present");
+        m_Batch.Flush(m_Renderer.get());
+        SDL_RenderPresent(m_Renderer.get());
+        m_Batch.m_DrawCalls = 0;
+    }
 
+    CWG_PROFILE("Events");
     SDL_Event event{};
     while(SDL_PollEvent(&event)) {
         switch(event.type) {
             case SDL_EVENT_QUIT: return false;
-            case SDL_EVENT_KEY_DOWN: m_KeyStates[(SDL_KeyCode) event.key.keysym.sym] = true; break;
-            case SDL_EVENT_KEY_UP: m_KeyStates[(SDL_KeyCode) event.key.keysym.sym] = false; break;
+            case SDL_EVENT_KEY_DOWN:
+                if(!event.key.repeat) m_KeyPresses[event.key.keysym.scancode] = true;
+                m_KeyStates[event.key.keysym.scancode] = true;
+                break;
+            case SDL_EVENT_KEY_UP: m_KeyStates[event.key.keysym.scancode] = false; break;
             case SDL_EVENT_MOUSE_BUTTON_DOWN: if(event.button.button == SDL_BUTTON_LEFT) m_MouseHeld = true; break;
             case SDL_EVENT_MOUSE_BUTTON_UP: if(event.button.button == SDL_BUTTON_LEFT) m_MouseHeld = false; break;
+            case SDL_EVENT_RENDER_TARGETS_RESET:
+            case SDL_EVENT_RENDER_DEVICE_RESET: m_TargetGeneration++; break;
             default: break;
         }
     }
@@ -75,6 +76,12 @@ bool Context::Update() {
     return true;
 }
 
+// Cosmetic effects decay per simulation tick so they last as long at any refresh rate.
+void Context::Tick() {
+    if(m_ShakeIntensity) m_ShakeIntensity -= Random::Cosmetic().UnsignedRandRange(2);
+    if(m_ShakeIntensity <= 0) m_ShakeIntensity = 0;
+}
+
 void Context::StopSounds() {
     SDLResultCheck(Mix_HaltChannel(-1));
 }
@@ -85,15 +92,37 @@ void Context::SetColor(Color color) {
 }
 
 void Context::Clear(Color color) {
+    m_Batch.Flush(m_Renderer.get());
     SetColor(color);
     SDLResultCheck(SDL_RenderClear(m_Renderer.get()));
 }
 
+Dimension Context::Shake() {
+    return m_Bound ? 0 : Random::Cosmetic().SignedRandRange(m_ShakeIntensity);
+}
+
 void Context::DrawRect(Dimension x, Dimension y, Dimension w, Dimension h, Color color) {
-    SetColor(color);
+    const AtlasRegion& solid = m_Atlas.Solid();
 
-    SDL_FRect rect {static_cast<float>(x + SignedRandRange(m_ShakeIntensity)), static_cast<float>(y + SignedRandRange(m_ShakeIntensity)), static_cast<float>(w), static_cast<float>(h)};
-    SDLResultCheck(SDL_RenderFillRect(m_Renderer.get(), &rect));
+    SDL_FRect rect {static_cast<float>(x + Shake()), static_cast<float>(y + Shake()), static_cast<float>(w), static_cast<float>(h)};
+    m_Batch.Draw(m_Renderer.get(), m_Atlas.Page(solid.m_Page), solid.m_UV, rect, 0.0f, ColorToSDL(color));
+}
+
+void Context::BeginTarget(RenderTarget& target) {
+    m_Batch.Flush(m_Renderer.get());
+    SDLResultCheck(SDL_SetRenderTarget(m_Renderer.get(), target.m_Texture.get()));
+    m_Bound = &target;
+}
+
+void Context::EndTarget() {
+    m_Batch.Flush(m_Renderer.get());
+    SDLResultCheck(SDL_SetRenderTarget(m_Renderer.get(), nullptr));
+    m_Bound = nullptr;
+}
+
+void Context::DrawTarget(RenderTarget& target, Dimension x, Dimension y) {
+    SDL_FRect rect {static_cast<float>(x + Shake()), static_cast<float>(y + Shake()), static_cast<float>(target.m_Width), static_cast<float>(target.m_Height)};
+    m_Batch.Draw(m_Renderer.get(), target.m_Texture.get(), {0.0f, 0.0f, 1.0f, 1.0f}, rect, 0.0f, ColorToSDL(Color::White));
 }
 
 [[nodiscard]] bool Context::IsMouseHeld() const {
@@ -106,6 +135,12 @@ void Context::DrawRect(Dimension x, Dimension y, Dimension w, Dimension h, Color
     return pressed;
 }
 
+[[nodiscard]] bool Context::WasKeyPressed(SDL_Scancode key) {
+    bool pressed = m_KeyPresses[key];
+    m_KeyPresses[key] = false;
+    return pressed;
+}
+
 [[nodiscard]] std::pair<Dimension, Dimension> Context::GetMousePosition() {
     std::pair<float, float> ret;
     SDL_GetMouseState(&ret.first, &ret.second);
@@ -115,7 +150,7 @@ void Context::DrawRect(Dimension x, Dimension y, Dimension w, Dimension h, Color
 void Context::Resize(Dimension width, Dimension height) {
     Width = width;
     Height = height;
-    SDL_SetWindowSize(m_Window.get(), Width, Height);
+    if(m_Window) SDL_SetWindowSize(m_Window.get(), Width, Height);
 }
 
 bool Context::ChoiceDialog(const std::string& title, const std::string& message) {
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Archive.hpp>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
+#endif
+
+static_assert(std::is_trivially_copyable_v<ArchiveHeader> && std::is_trivially_copyable_v<ArchiveEntry>);
+
+Archive::Archive(std::string directory) : m_Directory(std::move(directory)) {
+    std::string path = m_Directory + "/" + FileName;
+    if(!std::filesystem::exists(path)) return;
+
+    Map(path);
+
+    auto corrupt = [this, &path]() {
+        Close();
+        return std::runtime_error("Corrupt resource archive: " + path);
+    };
+
+    if(m_Size < sizeof(ArchiveHeader)) throw corrupt();
+
+    auto header = reinterpret_cast<const ArchiveHeader*>(m_Data);
+    if(!std::equal(std::begin(Magic), std::end(Magic), header->m_Magic) || header->m_Version != Version) throw corrupt();
+    if((m_Size - sizeof(ArchiveHeader)) / sizeof(ArchiveEntry) < header->m_EntryCount) throw corrupt();
+
+    m_Header = header;
+    m_Entries = reinterpret_cast<const ArchiveEntry*>(m_Data + sizeof(ArchiveHeader));
+
+    for(Dimension i = 0; i < EntryCount(); ++i) {
+        const ArchiveEntry& entry = m_Entries[i];
+        if(entry.m_Offset > m_Size || entry.m_Size > m_Size - entry.m_Offset) throw corrupt();
+        m_Names.emplace(std::string(entry.m_Name, std::find(entry.m_Name, entry.m_Name + ArchiveEntry::NameSize, '\0')), &entry);
+    }
+}
+
+Archive::~Archive() {
+    Close();
+}
+
+#ifdef _WIN32
+void Archive::Map(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) throw std::runtime_error("Failed to open " + path);
+    m_File = file;
+
+    LARGE_INTEGER size{};
+    if(!GetFileSizeEx(file, &size)) {
+        Close();
+        throw std::runtime_error("Failed to stat " + path);
+    }
+    m_Size = static_cast<std::size_t>(size.QuadPart);
+
+    m_Mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = m_Mapping ? MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if(!view) {
+        Close();
+        throw std::runtime_error("Failed to map " + path);
+    }
+    m_Data = static_cast<const std::byte*>(view);
+}
+
+void Archive::Close() {
+    if(m_Data) UnmapViewOfFile(m_Data);
+    if(m_Mapping) CloseHandle(m_Mapping);
+    if(m_File) CloseHandle(m_File);
+
+    m_Data = nullptr;
+    m_Mapping = nullptr;
+    m_File = nullptr;
+    m_Size = 0;
+    m_Header = nullptr;
+    m_Entries = nullptr;
+    m_Names.clear();
+}
+#else
+void Archive::Map(const std::string& path) {
+    m_File = open(path.c_str(), O_RDONLY);
+    if(m_File < 0) throw std::runtime_error("Failed to open " + path);
+
+    struct stat info{};
+    if(fstat(m_File, &info) != 0) {
+        Close();
+        throw std::runtime_error("Failed to stat " + path);
+    }
+    m_Size = static_cast<std::size_t>(info.st_size);
+
+    void* view = m_Size ? mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_File, 0) : MAP_FAILED;
+    if(view == MAP_FAILED) {
+        Close();
+        throw std::runtime_error("Failed to map " + path);
+    }
+    m_Data = static_cast<const std::byte*>(view);
+}
+
+void Archive::Close() {
+    if(m_Data) munmap(const_cast<std::byte*>(m_Data), m_Size);
+    if(m_File >= 0) close(m_File);
+
+    m_Data = nullptr;
+    m_File = -1;
+    m_Size = 0;
+    m_Header = nullptr;
+    m_Entries = nullptr;
+    m_Names.clear();
+}
+#endif
+
+const ArchiveEntry* Archive::Find(const std::string& name) const {
+    auto it = m_Names.find(name);
+    return it == m_Names.end() ? nullptr : it->second;
+}
+
+static std::filesystem::path ExecutableDirectory() {
+#if defined(_WIN32)
+    char path[MAX_PATH + 1] {};
+    if(!GetModuleFileNameA(nullptr, path, MAX_PATH)) return {};
+    return std::filesystem::path(path).parent_path();
+#elif defined(__APPLE__)
+    char path[PATH_MAX + 1] {};
+    uint32_t sz = sizeof(path);
+    if(_NSGetExecutablePath(path, &sz) != 0) return {};
+    return std::filesystem::path(path).parent_path();
+#else
+    std::error_code error;
+    auto path = std::filesystem::read_symlink("/proc/self/exe", error);
+    return error ? std::filesystem::path{} : path.parent_path();
+#endif
+}
+
+std::string ResourceDirectory() {
+    std::filesystem::path executable = ExecutableDirectory();
+    if(!executable.empty()) {
+#ifdef __APPLE__
+        std::filesystem::path bundled = executable / ".." / "Resources";
+#else
+        std::filesystem::path bundled = executable / "Resources";
+#endif
+        std::error_code error;
+        if(std::filesystem::is_directory(bundled, error)) return bundled.string();
+    }
+
+    return "Resources";
+}
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <CWG.hpp>
+#include <MoveTables.hpp>
+#include <Zobrist.hpp>
+
+Dimension Board::SquareScale = 64;
+Dimension Board::Width = 6;
+Dimension Board::Height = 6;
+
+bool Board::IsInBounds(Dimension x, Dimension y) {
+    return !(x < 0 || y < 0 || x >= Board::Width || y >= Board::Height);
+}
+
+bool Board::HasBitboards() {
+    return Width * Height <= MaxBitboardCells;
+}
+
+void Board::SetDimensions(Dimension width, Dimension height) {
+    Width = width;
+    Height = height;
+    if(HasBitboards()) MoveTables::Build();
+}
+
+Board::Board() {
+    m_Board.resize(Width * Height);
+    std::fill(m_Board.begin(), m_Board.end(), Piece::None);
+
+    m_DirtyCells.reserve(Width * Height);
+    m_Dirty.resize(Width * Height);
+}
+
+void Board::ClearDirty() {
+    for(Dimension cell : m_DirtyCells) m_Dirty[cell] = false;
+    m_DirtyCells.clear();
+}
+
+void Board::Set(Dimension x, Dimension y, Piece piece) {
+    Dimension cell = x + Width * y;
+
+    if(HasBitboards()) {
+        Bitboard bit = CellBit(cell);
+        m_Hash ^= Zobrist::PieceKey(m_Board[cell], cell) ^ Zobrist::PieceKey(piece, cell);
+        m_Pieces[static_cast<Dimension>(m_Board[cell])] &= ~bit;
+        m_Pieces[static_cast<Dimension>(piece)] |= bit;
+
+        if(piece == Piece::None) m_Occupied &= ~bit;
+        else m_Occupied |= bit;
+
+        if(IsPickup(piece)) m_Pickups |= bit;
+        else m_Pickups &= ~bit;
+    }
+
+    if(m_Board[cell] != piece && !m_Dirty[cell]) {
+        m_Dirty[cell] = true;
+        m_DirtyCells.push_back(cell);
+    }
+
+    m_Board[cell] = piece;
+}
+
+Piece Board::Get(Dimension x, Dimension y) const {
+    return m_Board[x + Width * y];
+}
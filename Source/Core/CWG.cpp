@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <CWG.hpp>
+
+static constexpr std::array<PieceMove, 0> NoMoves{};
+
+static constexpr std::array<PieceMove, 1> WhitePawnMoves {{{0, -1, false}}};
+static constexpr std::array<PieceMove, 1> BlackPawnMoves {{{0, 1, false}}};
+
+static constexpr std::array<PieceMove, 4> RookMoves {{{0, DimensionMax, true}, {0, DimensionMin, true}, {DimensionMax, 0, true}, {DimensionMin, 0, true}}};
+static constexpr std::array<PieceMove, 4> BishopMoves {{{DimensionMax, DimensionMax, true}, {DimensionMax, DimensionMin, true}, {DimensionMin, DimensionMax, true}, {DimensionMin, DimensionMin, true}}};
+static constexpr std::array<PieceMove, 8> KnightMoves {{{1, 2, false}, {-1, 2, false}, {1, -2, false}, {-1, -2, false}, {2, 1, false}, {-2, 1, false}, {2, -1, false}, {-2, -1, false}}};
+static constexpr std::array<PieceMove, 8> KingMoves {{{0, 1, false}, {1, 1, false}, {1, 0, false}, {1, -1, false}, {0, -1, false}, {-1, -1, false}, {-1, 0, false}, {-1, 1, false}}};
+static constexpr std::array<PieceMove, 8> QueenMoves {{{0, DimensionMax, true}, {DimensionMax, DimensionMax, true}, {DimensionMax, 0, true}, {DimensionMax, DimensionMin, true}, {0, DimensionMin, true}, {DimensionMin, DimensionMin, true}, {DimensionMin, 0, true}, {DimensionMin, DimensionMax, true}}};
+
+Span<const PieceMove> PieceMoves(Piece piece) {
+    switch(piece) {
+        case Piece::AmmoPickup:
+        case Piece::HealthPickup:
+        case Piece::BoostPickup:
+        case Piece::None: return Span<const PieceMove>(NoMoves);
+
+        case Piece::WhitePawn: return Span<const PieceMove>(WhitePawnMoves);
+        case Piece::BlackPawn: return Span<const PieceMove>(BlackPawnMoves);
+
+        case Piece::WhiteRook:
+        case Piece::BlackRook: return Span<const PieceMove>(RookMoves);
+
+        case Piece::WhiteBishop:
+        case Piece::BlackBishop: return Span<const PieceMove>(BishopMoves);
+
+        case Piece::WhiteKnight:
+        case Piece::BlackKnight: return Span<const PieceMove>(KnightMoves);
+
+        case Piece::WhiteKing:
+        case Piece::BlackKing: return Span<const PieceMove>(KingMoves);
+
+        case Piece::WhiteQueen:
+        case Piece::BlackQueen: return Span<const PieceMove>(QueenMoves);
+    }
+
+    return Span<const PieceMove>(NoMoves);
+}
+
+bool IsPickup(Piece piece) {
+    return piece == Piece::AmmoPickup || piece == Piece::HealthPickup || piece == Piece::BoostPickup;
+}
+
+std::unordered_map<Weapon, float> WeaponStats::WeaponDamages {
+    {Weapon::None, 0.0f},
+    {Weapon::Grenade, 11.0f},
+    {Weapon::Pistol, 9.0f},
+    {Weapon::Shotgun, 8.0f},
+    {Weapon::ScienceGun, 5.0f},
+    {Weapon::Rifle, 11.0f},
+    {Weapon::RocketLauncher, 37.0f}
+};
+
+std::unordered_map<Weapon, float> WeaponStats::WeaponSpreads {
+    {Weapon::None, 0.0f},
+    {Weapon::Grenade, ((360.0f * static_cast<float>(M_PI)) / 180.0f)},
+    {Weapon::Pistol, ((10.0f * static_cast<float>(M_PI)) / 180.0f)},
+    {Weapon::Shotgun, ((35.0f * static_cast<float>(M_PI)) / 180.0f)},
+    {Weapon::ScienceGun, ((15.0f * static_cast<float>(M_PI)) / 180.0f)},
+    {Weapon::Rifle, ((5.0f * static_cast<float>(M_PI)) / 180.0f)},
+    {Weapon::RocketLauncher, ((35.0f * static_cast<float>(M_PI)) / 180.0f)}
+};
+
+std::unordered_map<Weapon, float> WeaponStats::WeaponVariances {
+    {Weapon::None, 0.0f},
+    {Weapon::Grenade, 4.0f},
+    {Weapon::Pistol, 2.0f},
+    {Weapon::Shotgun, 1.0f},
+    {Weapon::ScienceGun, 3.0f},
+    {Weapon::Rifle, 4.0f},
+    {Weapon::RocketLauncher, 10.0f}
+};
+
+std::unordered_map<Weapon, Dimension> WeaponStats::WeaponCounts {
+    {Weapon::None, 0},
+    {Weapon::Grenade, 300},
+    {Weapon::Pistol, 1},
+    {Weapon::Shotgun, 7},
+    {Weapon::ScienceGun, 3},
+    {Weapon::Rifle, 2},
+    {Weapon::RocketLauncher, 1}
+};
+
+std::unordered_map<Weapon, Dimension> WeaponStats::WeaponAmmos {
+    {Weapon::None, 0},
+    {Weapon::Grenade, 6},
+    {Weapon::Pistol, 20},
+    {Weapon::Shotgun, 15},
+    {Weapon::ScienceGun, 6},
+    {Weapon::Rifle, 10},
+    {Weapon::RocketLauncher, 1}
+};
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Elements.hpp>
+#include <Random.hpp>
+
+Pickup::Pickup(Board& board) {
+    do {
+        m_X = Random::Gameplay().UnsignedRandRange(Board::Width - 1);
+        m_Y = Random::Gameplay().UnsignedRandRange(Board::Height - 1);
+    } while(board.Get(m_X, m_Y) != Piece::None);
+
+    if(Random::Gameplay().UnsignedRandRange(3)) board.Set(m_X, m_Y, Piece::AmmoPickup);
+    else if(Random::Gameplay().UnsignedRandRange(2)) board.Set(m_X, m_Y, Piece::BoostPickup);
+    else board.Set(m_X, m_Y, Piece::HealthPickup);
+}
+
+void Pickup::Place(Board& board) {
+    Dimension x = m_X;
+    Dimension y = m_Y;
+
+    do {
+        m_X = Random::Gameplay().UnsignedRandRange(Board::Width - 1);
+        m_Y = Random::Gameplay().UnsignedRandRange(Board::Height - 1);
+    } while(board.Get(m_X, m_Y) != Piece::None);
+
+    if(Random::Gameplay().UnsignedRandRange(3)) board.Set(m_X, m_Y, Piece::AmmoPickup);
+    else if(Random::Gameplay().UnsignedRandRange(2)) board.Set(m_X, m_Y, Piece::BoostPickup);
+    else board.Set(m_X, m_Y, Piece::HealthPickup);
+
+    board.Set(x, y, Piece::None);
+}
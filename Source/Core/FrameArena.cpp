@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <FrameArena.hpp>
+
+FrameArena::FrameArena(std::size_t capacity) : m_Block(std::make_unique<std::byte[]>(capacity)), m_Capacity(capacity) {}
+
+void* FrameArena::Allocate(std::size_t bytes, std::size_t alignment) {
+    auto base = reinterpret_cast<std::uintptr_t>(m_Block.get());
+    std::size_t offset = ((base + m_Used + alignment - 1) & ~(alignment - 1)) - base;
+
+    if(offset + bytes <= m_Capacity) {
+        m_Used = offset + bytes;
+        return m_Block.get() + offset;
+    }
+
+    // Over-allocate so the spilled block can be aligned too; new[] only
+    // guarantees fundamental alignment.
+    m_Spilled += bytes + alignment;
+    std::byte* spilled = m_Overflow.emplace_back(std::make_unique<std::byte[]>(bytes + alignment)).get();
+    auto address = reinterpret_cast<std::uintptr_t>(spilled);
+    return spilled + (((address + alignment - 1) & ~(alignment - 1)) - address);
+}
+
+void FrameArena::Reset() {
+    m_Peak = std::max(m_Peak, Used());
+
+    if(!m_Overflow.empty()) {
+        m_Overflow.clear();
+        m_Capacity = std::max(m_Capacity * 2, m_Peak);
+        m_Block = std::make_unique<std::byte[]>(m_Capacity);
+    }
+
+    m_Used = 0;
+    m_Spilled = 0;
+}
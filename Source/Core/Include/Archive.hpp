@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+enum class ArchiveKind : std::uint32_t {
+    AtlasPage, // Raw RGBA32 pixels, m_Width * m_Height * 4 bytes.
+    Sprite, // A region of atlas page m_Page, no payload.
+    Solid, // The opaque white region used for untextured rects, no payload.
+    Sound // PCM in the audio format recorded in the header.
+};
+
+struct ArchiveHeader {
+    char m_Magic[4];
+    std::uint32_t m_Version;
+    std::uint32_t m_EntryCount;
+    std::uint32_t m_AudioFrequency;
+    std::uint32_t m_AudioFormat;
+    std::uint32_t m_AudioChannels;
+};
+
+struct ArchiveEntry {
+    static constexpr Dimension NameSize = 48;
+
+    char m_Name[NameSize];
+    ArchiveKind m_Kind;
+    std::uint32_t m_Page;
+    std::int32_t m_X;
+    std::int32_t m_Y;
+    std::int32_t m_Width;
+    std::int32_t m_Height;
+    std::uint64_t m_Offset;
+    std::uint64_t m_Size;
+};
+
+// A read-only view of a packed resource archive. The file is mapped rather
+// than read so payloads can be handed straight to SDL without copying.
+// The format is little-endian and mirrors the structs above byte for byte.
+class Archive {
+public:
+    static constexpr char Magic[4] = {'C', 'W', 'G', 'A'};
+    static constexpr std::uint32_t Version = 1;
+    static constexpr const char FileName[] = "CWG.cwga";
+    static constexpr std::uint64_t PayloadAlignment = 16;
+
+private:
+    std::string m_Directory;
+
+    const std::byte* m_Data{};
+    std::size_t m_Size{};
+#ifdef _WIN32
+    void* m_File{};
+    void* m_Mapping{};
+#else
+    int m_File{-1};
+#endif
+
+    const ArchiveHeader* m_Header{};
+    const ArchiveEntry* m_Entries{};
+    std::unordered_map<std::string, const ArchiveEntry*> m_Names;
+
+    void Map(const std::string& path);
+    void Close();
+
+public:
+    Archive() = default;
+    // Leaves the archive closed if the directory has no archive file.
+    explicit Archive(std::string directory);
+    ~Archive();
+
+    Archive(const Archive&) = delete;
+    Archive& operator=(const Archive&) = delete;
+
+    [[nodiscard]] bool IsOpen() const { return m_Header != nullptr; }
+    [[nodiscard]] const std::string& Directory() const { return m_Directory; }
+    [[nodiscard]] const ArchiveHeader& Header() const { return *m_Header; }
+
+    [[nodiscard]] Dimension EntryCount() const { return m_Header ? static_cast<Dimension>(m_Header->m_EntryCount) : 0; }
+    [[nodiscard]] const ArchiveEntry& Entry(Dimension index) const { return m_Entries[index]; }
+    [[nodiscard]] const ArchiveEntry* Find(const std::string& name) const;
+    [[nodiscard]] const std::byte* Payload(const ArchiveEntry& entry) const { return m_Data + entry.m_Offset; }
+};
+
+// The directory holding loose resources and the archive: `Resources` next to
+// the executable (`../Resources` inside a macOS bundle), falling back to
+// `Resources` in the working directory.
+std::string ResourceDirectory();
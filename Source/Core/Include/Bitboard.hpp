@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using Bitboard = std::uint64_t;
+
+static constexpr Dimension MaxBitboardCells = 64;
+
+inline Bitboard CellBit(Dimension cell) {
+    return Bitboard{1} << cell;
+}
+
+inline Dimension LowestBit(Bitboard board) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, board);
+    return static_cast<Dimension>(index);
+#else
+    return __builtin_ctzll(board);
+#endif
+}
+
+inline Dimension HighestBit(Bitboard board) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, board);
+    return static_cast<Dimension>(index);
+#else
+    return 63 - __builtin_clzll(board);
+#endif
+}
+
+inline Dimension BitCount(Bitboard board) {
+#ifdef _MSC_VER
+    return static_cast<Dimension>(__popcnt64(board));
+#else
+    return __builtin_popcountll(board);
+#endif
+}
+
+inline Dimension PopLowestBit(Bitboard& board) {
+    Dimension index = LowestBit(board);
+    board &= board - 1;
+    return index;
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <Bitboard.hpp>
+
+enum class Piece {
+    None,
+
+    WhitePawn,
+    WhiteRook,
+    WhiteBishop,
+    WhiteKnight,
+    WhiteKing,
+    WhiteQueen,
+
+    BlackPawn,
+    BlackRook,
+    BlackBishop,
+    BlackKnight,
+    BlackKing,
+    BlackQueen,
+
+    AmmoPickup,
+    HealthPickup,
+    BoostPickup
+};
+
+static constexpr Dimension PieceCount = static_cast<Dimension>(Piece::BoostPickup) + 1;
+
+enum class Weapon {
+    None,
+
+    Grenade,
+    Pistol,
+    Shotgun,
+    ScienceGun,
+    Rifle,
+    RocketLauncher
+};
+
+struct PieceMove {
+    Dimension m_Dx;
+    Dimension m_Dy;
+    bool m_Fill;
+};
+
+class Board {
+public:
+    static Dimension SquareScale;
+    static Dimension Width;
+    static Dimension Height;
+
+private:
+    std::vector<Piece> m_Board;
+    // Cells changed since the last ClearDirty, each listed once.
+    std::vector<Dimension> m_DirtyCells;
+    std::vector<bool> m_Dirty;
+
+    std::array<Bitboard, PieceCount> m_Pieces{};
+    Bitboard m_Occupied{};
+    Bitboard m_Pickups{};
+    std::uint64_t m_Hash{};
+
+public:
+    static bool IsInBounds(Dimension x, Dimension y);
+    static bool HasBitboards();
+    static void SetDimensions(Dimension width, Dimension height);
+
+    Board();
+
+    void Set(Dimension x, Dimension y, Piece piece);
+    [[nodiscard]] Piece Get(Dimension x, Dimension y) const;
+    [[nodiscard]] const Piece* Cells() const { return m_Board.data(); }
+
+    // For views that cache the board and redraw only what changed.
+    [[nodiscard]] const std::vector<Dimension>& DirtyCells() const { return m_DirtyCells; }
+    void ClearDirty();
+
+    [[nodiscard]] Bitboard Pieces(Piece piece) const { return m_Pieces[static_cast<Dimension>(piece)]; }
+    [[nodiscard]] Bitboard Occupied() const { return m_Occupied; }
+    [[nodiscard]] Bitboard Pickups() const { return m_Pickups; }
+    [[nodiscard]] Bitboard Blockers() const { return m_Occupied & ~m_Pickups; }
+    // Zobrist hash of the placement; only maintained alongside the bitboards.
+    [[nodiscard]] std::uint64_t Hash() const { return m_Hash; }
+};
+
+Span<const PieceMove> PieceMoves(Piece piece);
+bool IsPickup(Piece piece);
+
+struct WeaponStats {
+    static std::unordered_map<Weapon, float> WeaponDamages;
+    static std::unordered_map<Weapon, float> WeaponSpreads;
+    static std::unordered_map<Weapon, float> WeaponVariances;
+    static std::unordered_map<Weapon, Dimension> WeaponCounts;
+    static std::unordered_map<Weapon, Dimension> WeaponAmmos;
+};
+
+enum class AIStrength {
+    Human,
+    Random,
+    Easy,
+    Normal,
+    Hard
+};
+
+struct GameSettings {
+    struct {
+        Dimension m_TitleScrollers;
+    } m_UISettings;
+
+    bool m_SFX;
+    bool m_MoveTimer;
+
+    Piece m_WhitePiece;
+    Weapon m_WhiteWeapon;
+    AIStrength m_WhiteAI;
+
+    Piece m_BlackPiece;
+    Weapon m_BlackWeapon;
+    AIStrength m_BlackAI;
+};
+
+enum class ActionKind {
+    None,
+    Move,
+    Fire
+};
+
+struct TurnAction {
+    ActionKind m_Kind{ActionKind::None};
+    Dimension m_Dx{};
+    Dimension m_Dy{};
+    float m_Rotation{};
+};
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <memory>
+#include <stdexcept>
+#include <array>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <climits>
+#include <limits>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <chrono>
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+#include <new>
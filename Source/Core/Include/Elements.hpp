@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+
+class Pickup {
+public:
+    Dimension m_X;
+    Dimension m_Y;
+
+    Pickup(Board& board);
+    void Place(Board& board);
+};
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+// A bump allocator for data that lives no longer than one frame or tick.
+// Allocation is a pointer bump and nothing is freed until `Reset`. A frame
+// that runs past the block spills into heap blocks, and the next `Reset` grows
+// the block to fit, so a steady workload stops touching the heap after the
+// first few frames. Not thread-safe.
+class FrameArena {
+public:
+    static constexpr std::size_t DefaultCapacity = 64 * 1024;
+
+private:
+    std::unique_ptr<std::byte[]> m_Block;
+    std::size_t m_Capacity;
+    std::size_t m_Used{};
+    std::size_t m_Peak{};
+
+    std::vector<std::unique_ptr<std::byte[]>> m_Overflow;
+    std::size_t m_Spilled{};
+
+public:
+    explicit FrameArena(std::size_t capacity = DefaultCapacity);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    [[nodiscard]] void* Allocate(std::size_t bytes, std::size_t alignment);
+    // Invalidates everything allocated since the last reset.
+    void Reset();
+
+    [[nodiscard]] std::size_t Used() const { return m_Used + m_Spilled; }
+    [[nodiscard]] std::size_t Capacity() const { return m_Capacity; }
+    // The most any frame has used so far.
+    [[nodiscard]] std::size_t Peak() const { return m_Peak; }
+};
+
+// Lets standard containers allocate from a FrameArena. Deallocation is a
+// no-op, so a container growing inside a frame leaves its old buffers behind
+// until the reset; reserve up front where the size is known.
+template<class T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    FrameArena* m_Arena;
+
+    explicit ArenaAllocator(FrameArena& arena) : m_Arena(&arena) {}
+    template<class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : m_Arena(other.m_Arena) {}
+
+    [[nodiscard]] T* allocate(std::size_t count) { return static_cast<T*>(m_Arena->Allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T*, std::size_t) {}
+
+    template<class U>
+    bool operator==(const ArenaAllocator<U>& other) const { return m_Arena == other.m_Arena; }
+    template<class U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return m_Arena != other.m_Arena; }
+};
+
+template<class T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <Elements.hpp>
+#include <Player.hpp>
+#include <Projectiles.hpp>
+#include <Replay.hpp>
+#include <TranspositionTable.hpp>
+#include <ShotEvaluator.hpp>
+
+struct TickResult {
+    bool m_Moved{};
+    bool m_Fired{};
+    Piece m_Pickup{Piece::None};
+
+    bool m_Hit{};
+    float m_Damage{};
+
+    bool m_Over{};
+    Dimension m_Winner{};
+};
+
+// Running totals per player slot, for balance tooling.
+struct MatchStats {
+    std::array<Dimension, 2> m_Shots{};
+    std::array<Dimension, 2> m_Hits{};
+    std::array<float, 2> m_Damage{};
+};
+
+class Match {
+public:
+    static constexpr Dimension FramesPerTurn = 45;
+    static constexpr Dimension PlayerCount = 2;
+
+private:
+    static std::uint64_t SeedStreams(std::uint64_t seed);
+
+public:
+    std::uint64_t m_Seed;
+    Replay m_Replay;
+
+    Board m_Board;
+    std::array<Player, PlayerCount> m_Players;
+    std::array<Pickup, 2> m_Pickups;
+    ProjectileStore m_Projectiles;
+    // Only allocated when a side searches; null for Random and Human players.
+    std::unique_ptr<TranspositionTable> m_Table;
+    ShotEvaluator m_Shots;
+    MatchStats m_Stats;
+
+    Dimension m_Tick{};
+    Dimension m_Turn{};
+    Dimension m_Dead{};
+
+    Dimension m_FramesPerTurn;
+    Dimension m_FramesThisTurn{};
+    bool m_Moved{};
+    bool m_Playback{};
+
+private:
+    // Reset at the start of every tick; holds that tick's hits.
+    FrameArena m_TickArena;
+
+public:
+    Match(const GameSettings& settings, std::uint64_t seed, ThreadPool* pool = nullptr);
+
+    Player& Current();
+    TickResult Tick(const TurnAction& action);
+    [[nodiscard]] std::uint64_t Hash() const;
+};
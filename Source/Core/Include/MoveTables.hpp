@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <Bitboard.hpp>
+#include <CWG.hpp>
+
+class MoveTables {
+private:
+    static constexpr Dimension DirectionCount = 8;
+
+    static std::array<std::array<Bitboard, MaxBitboardCells>, PieceCount> Steps;
+    static std::array<std::array<Bitboard, MaxBitboardCells>, DirectionCount> Rays;
+    static std::array<Dimension, PieceCount> SlideDirections;
+
+    static Dimension Direction(Dimension dx, Dimension dy);
+    static bool IsAscending(Dimension direction);
+
+public:
+    static void Build();
+
+    static Bitboard StepMoves(Piece piece, Dimension cell) { return Steps[static_cast<Dimension>(piece)][cell]; }
+    static Bitboard SlideMoves(Piece piece, Dimension cell, Bitboard blockers, Bitboard pickups);
+};
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <Elements.hpp>
+#include <Projectiles.hpp>
+
+class TranspositionTable;
+class ShotEvaluator;
+
+class Player {
+public:
+    static constexpr float MaxHealth = 100.0f;
+    static constexpr Dimension MaxPositions = 64;
+
+    using Positions = FixedVector<std::pair<Dimension, Dimension>, MaxPositions>;
+
+private:
+    static constexpr float ProjectileSpeed = 10.0f;
+
+    std::uint64_t m_Hash{};
+
+public:
+    std::string m_Name;
+    Piece m_Piece;
+    Weapon m_Weapon;
+    Color m_Color;
+    Color m_AmmoColor;
+
+    // Health, ammo and boost are only written through SetStats, which keeps
+    // m_Hash in step with them.
+    Dimension m_Ammo;
+
+    bool m_Dead{};
+
+    Dimension m_X;
+    Dimension m_Y;
+
+    Dimension m_DamageBoost{};
+
+    float m_Health{MaxHealth};
+
+    AIStrength m_AI{};
+
+public:
+    Player(Piece piece, Weapon weapon, AIStrength ai, Dimension x, Dimension y, Board& board, std::string  name, Color color, Color ammo_color);
+
+    [[nodiscard]] bool IsAI() const { return m_AI != AIStrength::Human; }
+    [[nodiscard]] bool Searches() const { return IsAI() && m_AI != AIStrength::Random; }
+
+    void Move(Board& board, Dimension dx, Dimension dy);
+    void EnumerateValidPositions(Board& board, Positions& positions) const;
+    Bitboard ValidTargets(Board& board) const;
+    Piece PickupCheck(Board& board, Dimension x, Dimension y, Span<Pickup> pickups);
+    bool Fire(float rotation, ProjectileStore& projectiles, Dimension owner);
+    TurnAction ChooseAction(Board& board, Span<Player> players, TranspositionTable* table, ShotEvaluator* shots) const;
+    bool Hurt(float damage);
+    [[nodiscard]] std::uint64_t Hash() const { return m_Hash; }
+
+private:
+    void SetStats(float health, Dimension ammo, Dimension boost);
+};
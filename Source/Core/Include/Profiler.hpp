@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+// Heap allocations made by one thread. Only counted when built with
+// CWG_ALLOCATION_TRACKING, which replaces the global operator new; otherwise
+// always zero.
+struct AllocationCount {
+    std::uint64_t m_Count;
+    std::uint64_t m_Bytes;
+
+    AllocationCount operator-(const AllocationCount& other) const { return {m_Count - other.m_Count, m_Bytes - other.m_Bytes}; }
+};
+
+struct ProfileSample {
+    // Always a string literal; samples outlive the scopes that record them.
+    const char* m_Name;
+    std::uint64_t m_Start;
+    std::uint64_t m_Duration;
+    std::uint32_t m_Thread;
+    AllocationCount m_Allocations;
+};
+
+// Scoped timings from any thread go into a fixed ring. Writers claim a slot
+// with one atomic increment and publish it with a per-slot sequence number,
+// so recording never blocks. Readers keep their own cursor and skip slots
+// that were overwritten or are still being written.
+class Profiler {
+public:
+    static constexpr std::uint64_t Capacity = 1 << 14;
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> m_Sequence{};
+        ProfileSample m_Sample{};
+    };
+
+    std::unique_ptr<Slot[]> m_Slots;
+    std::atomic<std::uint64_t> m_Head{};
+    std::chrono::steady_clock::time_point m_Epoch;
+
+    std::mutex m_TraceMutex;
+    std::string m_TracePath;
+    std::vector<ProfileSample> m_Trace;
+    std::uint64_t m_TraceCursor{};
+
+    Profiler();
+
+public:
+#ifdef CWG_ALLOCATION_TRACKING
+    static constexpr bool TracksAllocations = true;
+#else
+    static constexpr bool TracksAllocations = false;
+#endif
+
+    static Profiler& Get();
+    static std::uint32_t ThreadIndex();
+    // Running totals for the calling thread.
+    static AllocationCount Allocations();
+    // Running count across every thread, for checks that span a pool.
+    static std::uint64_t TotalAllocations();
+
+    // Nanoseconds since the profiler was created.
+    [[nodiscard]] std::uint64_t Now() const;
+
+    void Record(const char* name, std::uint64_t start, std::uint64_t end, AllocationCount allocations = {});
+
+    // Appends every complete sample from `cursor` onwards and advances it.
+    // Sequence 2n + 1 marks slot n as being written, 2n + 2 as complete.
+    template<class Samples>
+    void Collect(std::uint64_t& cursor, Samples& samples) const {
+        std::uint64_t head = m_Head.load(std::memory_order_acquire);
+        if(head > Capacity) cursor = std::max(cursor, head - Capacity);
+
+        for(; cursor < head; ++cursor) {
+            const Slot& slot = m_Slots[cursor & (Capacity - 1)];
+            std::uint64_t sequence = slot.m_Sequence.load(std::memory_order_acquire);
+            // Still being written: pick it up next time.
+            if(sequence < 2 * cursor + 2) break;
+            if(sequence != 2 * cursor + 2) continue;
+
+            ProfileSample sample = slot.m_Sample;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot.m_Sequence.load(std::memory_order_relaxed) != sequence) continue;
+
+            samples.push_back(sample);
+        }
+    }
+
+    // Keeps every sample from now on and writes them as a Chrome trace
+    // (chrome://tracing, Perfetto) on EndTrace. PumpTrace must run often
+    // enough that the ring does not lap the trace cursor; once a frame is plenty.
+    void BeginTrace(std::string path);
+    void PumpTrace();
+    void EndTrace();
+};
+
+class ProfileScope {
+private:
+    const char* m_Name;
+    std::uint64_t m_Start;
+    AllocationCount m_Allocations;
+
+public:
+    explicit ProfileScope(const char* name) : m_Name(name), m_Start(Profiler::Get().Now()), m_Allocations(Profiler::Allocations()) {}
+    ~ProfileScope() { Profiler::Get().Record(m_Name, m_Start, Profiler::Get().Now(), Profiler::Allocations() - m_Allocations); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define CWG_PROFILE_JOIN_INNER(a, b) a##b
+#define CWG_PROFILE_JOIN(a, b) CWG_PROFILE_JOIN_INNER(a, b)
+#define CWG_PROFILE(name) ProfileScope CWG_PROFILE_JOIN(profile_scope_, __LINE__){name}
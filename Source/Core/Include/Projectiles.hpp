@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <FrameArena.hpp>
+
+struct ProjectileHit {
+    Dimension m_Owner;
+    Piece m_Piece;
+};
+
+using ProjectileHits = ArenaVector<ProjectileHit>;
+
+// Every live projectile in a match, stored as parallel arrays so the step
+// pass runs over contiguous floats. Freed slots are recycled through a
+// stack; `m_High` bounds the range of slots that have ever been used.
+class ProjectileStore {
+public:
+    static constexpr Dimension ProjectileScale = 4;
+    static constexpr Dimension DefaultCapacity = 4096;
+    static constexpr std::int32_t NoOwner = -1;
+
+    std::vector<float> m_X;
+    std::vector<float> m_Y;
+    // Positions before the last step, for interpolating between ticks.
+    std::vector<float> m_PrevX;
+    std::vector<float> m_PrevY;
+    std::vector<float> m_Vx;
+    std::vector<float> m_Vy;
+    std::vector<std::int32_t> m_Owner;
+
+private:
+    std::vector<Dimension> m_Free;
+    Dimension m_High{};
+    Dimension m_Live{};
+
+    void Resolve(Dimension index, bool in_bounds, Piece piece, Span<const Piece> owners, ProjectileHits& hits);
+    void Sweep(const Board& board, Dimension index, float x0, float y0, Span<const Piece> owners, ProjectileHits& hits);
+    Dimension StepBlocks(const Board& board, Span<const Piece> owners, ProjectileHits& hits);
+
+public:
+    explicit ProjectileStore(Dimension capacity = DefaultCapacity);
+
+    [[nodiscard]] Dimension Capacity() const { return static_cast<Dimension>(m_X.size()); }
+    [[nodiscard]] Dimension High() const { return m_High; }
+    [[nodiscard]] Dimension Live() const { return m_Live; }
+    [[nodiscard]] bool IsAlive(Dimension index) const { return m_Owner[index] != NoOwner; }
+
+    // Returns false if the store is full and the projectile was dropped.
+    bool Spawn(float x, float y, float rotation, float speed, Dimension owner);
+    void Kill(Dimension index);
+    void Clear();
+
+    // Advances every projectile, retires those that leave the board and
+    // appends a hit for the first piece other than its owner's that each one
+    // passes over (`owners` maps owner index to piece). Hits and kills happen in
+    // slot order whichever kernel runs, so results match across builds.
+    void Step(const Board& board, Span<const Piece> owners, ProjectileHits& hits);
+};
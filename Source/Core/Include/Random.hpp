@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+enum class RandomStream {
+    Gameplay,
+    AI,
+    Cosmetic
+};
+
+class Random {
+private:
+    RandomStream m_Stream;
+    std::array<std::uint64_t, 4> m_State{};
+
+public:
+    static std::uint64_t EntropySeed();
+    static std::uint64_t SplitMix64(std::uint64_t& state);
+
+    static Random& Gameplay();
+    static Random& AI();
+    static Random& Cosmetic();
+
+    explicit Random(RandomStream stream, std::uint64_t seed);
+
+    void Seed(std::uint64_t seed);
+    std::uint64_t Next();
+
+    float SignedRandRange(float range);
+    Dimension SignedRandRange(Dimension range);
+    Dimension UnsignedRandRange(Dimension range);
+};
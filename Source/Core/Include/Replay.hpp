@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+
+struct TickResult;
+
+struct ReplayInput {
+    Dimension m_Tick;
+    TurnAction m_Action;
+};
+
+class Replay {
+public:
+    static constexpr char Magic[4] = {'C', 'W', 'G', 'R'};
+    static constexpr std::uint32_t Version = 4;
+    // Inputs are reserved up front so recording does not reallocate mid-match.
+    static constexpr std::size_t ReservedInputs = 4096;
+
+    std::uint64_t m_Seed{};
+    Dimension m_Width{};
+    Dimension m_Height{};
+    GameSettings m_Settings{};
+
+    Dimension m_Ticks{};
+    std::vector<ReplayInput> m_Inputs;
+
+private:
+    std::size_t m_Cursor{};
+
+public:
+    Replay() = default;
+    Replay(const GameSettings& settings, std::uint64_t seed);
+
+    static Replay Load(const std::string& path);
+    void Save(const std::string& path) const;
+
+    void Record(Dimension tick, const TurnAction& action);
+    TurnAction Input(Dimension tick);
+    [[nodiscard]] bool Finished(Dimension tick) const;
+
+    TickResult Simulate();
+};
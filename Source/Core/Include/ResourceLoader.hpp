@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <ThreadPool.hpp>
+#include <Archive.hpp>
+
+struct ResourceHandle {
+    std::uint32_t m_Index{UINT32_MAX};
+    std::uint32_t m_Generation{};
+
+    [[nodiscard]] bool IsValid() const { return m_Index != UINT32_MAX; }
+};
+
+// Resources live in fixed-size slabs which are never moved, so references
+// handed out by `Get` stay valid until the resource is evicted. Names found
+// in the archive are built from its mapped payloads, anything else is
+// decoded from the loose file in the archive's directory.
+template<class T>
+class ResourceLoader {
+private:
+    using Decoded = typename T::Decoded;
+
+    static constexpr std::uint32_t SlabSize = 64;
+
+    struct Slot {
+        T m_Resource{};
+        std::string m_Path{};
+        std::uint32_t m_Generation{};
+        Dimension m_References{};
+        std::size_t m_Bytes{};
+        bool m_Live{};
+    };
+
+    std::string m_ResourceDirectory;
+    const Archive* m_Archive;
+    std::vector<std::unique_ptr<std::array<Slot, SlabSize>>> m_Slabs;
+    std::vector<std::uint32_t> m_Free;
+    std::uint32_t m_Count{0};
+    std::size_t m_Bytes{0};
+    std::unordered_map<std::string, std::uint32_t> m_Map;
+
+    ThreadPool* m_Pool;
+    std::unordered_map<std::string, std::future<Decoded>> m_Pending;
+
+    Slot& At(std::uint32_t index) { return (*m_Slabs[index / SlabSize])[index % SlabSize]; }
+    const Slot& At(std::uint32_t index) const { return (*m_Slabs[index / SlabSize])[index % SlabSize]; }
+
+    std::uint32_t Allocate() {
+        if(!m_Free.empty()) {
+            std::uint32_t index = m_Free.back();
+            m_Free.pop_back();
+            return index;
+        }
+
+        if(m_Count == m_Slabs.size() * SlabSize) m_Slabs.emplace_back(std::make_unique<std::array<Slot, SlabSize>>());
+        return m_Count++;
+    }
+
+    template<class... Args>
+    std::uint32_t Load(const std::string& path, Args&... args) {
+        auto it = m_Map.find(path);
+        if(it != m_Map.end()) return it->second;
+
+        std::uint32_t index = Allocate();
+        Slot& slot = At(index);
+
+        try {
+            const ArchiveEntry* entry = m_Archive->Find(path);
+            auto pending = m_Pending.find(path);
+            if(entry) {
+                slot.m_Resource = T(*m_Archive, *entry, args...);
+            }
+            else if(pending != m_Pending.end()) {
+                // Erased first, so a failed decode is retried from the file
+                // next time rather than rethrown from a spent future.
+                std::future<Decoded> decoding = std::move(pending->second);
+                m_Pending.erase(pending);
+                slot.m_Resource = T(decoding.get(), args...);
+            }
+            else {
+                slot.m_Resource = T(m_ResourceDirectory + path, args...);
+            }
+        }
+        catch(...) {
+            m_Free.push_back(index);
+            throw;
+        }
+
+        slot.m_Path = path;
+        slot.m_References = 0;
+        slot.m_Bytes = slot.m_Resource.Bytes();
+        slot.m_Live = true;
+        m_Bytes += slot.m_Bytes;
+        m_Map.emplace(path, index);
+
+        return index;
+    }
+
+public:
+    explicit ResourceLoader(const Archive& archive, ThreadPool* pool = nullptr) : m_ResourceDirectory(archive.Directory() + "/"), m_Archive(&archive), m_Pool(pool) {}
+
+    // Starts decoding a loose file on the pool, to be picked up by `Load`.
+    // Archived names are skipped: textures there are atlas regions and
+    // sounds are PCM played from the mapping, so they have nothing to
+    // decode. With a packed archive, as shipped, this only covers loose
+    // files missing from it (and sounds whose device format differs from
+    // the pack, which decode on the caller).
+    void Request(const std::string& path) {
+        if(!m_Pool || m_Archive->Find(path) || m_Map.count(path) || m_Pending.count(path)) return;
+
+        std::string full_path = m_ResourceDirectory + path;
+        m_Pending.emplace(path, m_Pool->Submit([full_path]() { return T::Decode(full_path); }));
+    }
+
+    void RequestAll(const std::string& extension) {
+        std::error_code error;
+        for(auto& entry : std::filesystem::directory_iterator(m_ResourceDirectory, error)) {
+            if(entry.path().extension() == extension) Request(entry.path().filename().string());
+        }
+    }
+
+    [[nodiscard]] bool IsReady(const std::string& path) const {
+        auto it = m_Pending.find(path);
+        if(it == m_Pending.end()) return m_Map.count(path);
+        return it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // Every `Acquire` or `Get` holds a reference until the matching `Release`.
+    template<class... Args>
+    ResourceHandle Acquire(const std::string& path, Args&... args) {
+        std::uint32_t index = Load(path, args...);
+        Slot& slot = At(index);
+        ++slot.m_References;
+
+        return {index, slot.m_Generation};
+    }
+
+    template<class... Args>
+    T& Get(const std::string& path, Args&... args) {
+        return *Resolve(Acquire(path, args...));
+    }
+
+    [[nodiscard]] T* Resolve(ResourceHandle handle) {
+        if(!handle.IsValid() || handle.m_Index >= m_Count) return nullptr;
+
+        Slot& slot = At(handle.m_Index);
+        if(!slot.m_Live || slot.m_Generation != handle.m_Generation) return nullptr;
+
+        return &slot.m_Resource;
+    }
+
+    void Release(ResourceHandle handle) {
+        if(Resolve(handle)) {
+            Slot& slot = At(handle.m_Index);
+            if(slot.m_References > 0) --slot.m_References;
+        }
+    }
+
+    void Release(const std::string& path) {
+        auto it = m_Map.find(path);
+        if(it != m_Map.end()) {
+            Slot& slot = At(it->second);
+            if(slot.m_References > 0) --slot.m_References;
+        }
+    }
+
+    // Frees every resource with no outstanding references and returns the bytes reclaimed.
+    std::size_t Evict() {
+        std::size_t reclaimed = 0;
+
+        for(std::uint32_t i = 0; i < m_Count; ++i) {
+            Slot& slot = At(i);
+            if(!slot.m_Live || slot.m_References > 0) continue;
+
+            m_Map.erase(slot.m_Path);
+            reclaimed += slot.m_Bytes;
+
+            slot.m_Resource = T{};
+            slot.m_Path.clear();
+            slot.m_Bytes = 0;
+            slot.m_Live = false;
+            ++slot.m_Generation;
+            m_Free.push_back(i);
+        }
+
+        m_Bytes -= reclaimed;
+        return reclaimed;
+    }
+
+    [[nodiscard]] std::size_t Bytes() const { return m_Bytes; }
+    [[nodiscard]] std::size_t Size() const { return m_Map.size(); }
+};
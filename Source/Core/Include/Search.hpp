@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <Bitboard.hpp>
+
+class Player;
+class TranspositionTable;
+
+struct SearchLimits {
+    double m_Milliseconds;
+    Dimension m_MaxDepth;
+
+    static SearchLimits For(AIStrength strength);
+};
+
+struct SearchSide {
+    Piece m_Piece;
+    Dimension m_Cell;
+    float m_Health;
+    Dimension m_Ammo;
+    Dimension m_MaxAmmo;
+    Dimension m_Boost;
+
+    float m_Damage;
+    float m_Spread;
+    Dimension m_Count;
+};
+
+// A compact copy of everything the search reads, cheap enough to copy per
+// node. Side 0 is always the side to move. m_Hash matches Match::Hash for
+// the same position and is kept up to date by Searcher::Apply. Pickups
+// vanish once taken; the real game respawns them at random, which the
+// search does not model.
+struct SearchState {
+    std::array<SearchSide, 2> m_Sides;
+    Bitboard m_AmmoPickups;
+    Bitboard m_HealthPickups;
+    Bitboard m_BoostPickups;
+    std::uint64_t m_Hash;
+
+    static SearchState From(const Board& board, const Player& self, const Player& other);
+
+    [[nodiscard]] Bitboard Pickups() const { return m_AmmoPickups | m_HealthPickups | m_BoostPickups; }
+};
+
+struct SearchMove {
+    ActionKind m_Kind{ActionKind::None};
+    Dimension m_To{};
+
+    bool operator==(const SearchMove& other) const { return m_Kind == other.m_Kind && m_To == other.m_To; }
+};
+
+struct SearchResult {
+    TurnAction m_Action;
+    float m_Score{};
+    Dimension m_Depth{};
+    std::uint64_t m_Nodes{};
+};
+
+// Negamax alpha-beta with iterative deepening. Each depth is searched in
+// full or discarded, so the answer always comes from the deepest completed
+// iteration within the time budget.
+class Searcher {
+public:
+    static constexpr float Win = 10000.0f;
+    static constexpr Dimension MaxMoves = MaxBitboardCells + 1;
+
+    using Moves = FixedVector<SearchMove, MaxMoves>;
+
+private:
+    SearchLimits m_Limits;
+    TranspositionTable* m_Table;
+    std::chrono::steady_clock::time_point m_Deadline{};
+    std::uint64_t m_Nodes{};
+    bool m_Stopped{};
+
+    bool OutOfTime();
+    float Negamax(const SearchState& state, Dimension depth, float alpha, float beta, Dimension ply);
+
+public:
+    explicit Searcher(SearchLimits limits, TranspositionTable* table = nullptr) : m_Limits(limits), m_Table(table) {}
+
+    static void Generate(const SearchState& state, Moves& moves);
+    static SearchState Apply(const SearchState& state, const SearchMove& move);
+    static float Evaluate(const SearchState& state);
+    // Expected damage of one shot aimed straight at the other side.
+    static float ShotValue(const SearchSide& shooter, const SearchSide& target);
+
+    SearchResult Run(const SearchState& root);
+};
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+
+class ThreadPool;
+
+struct ShotQuery {
+    Piece m_Shooter;
+    Piece m_Target;
+    Dimension m_X;
+    Dimension m_Y;
+    Weapon m_Weapon;
+    Dimension m_Boost;
+    float m_Angle;
+};
+
+struct ShotEstimate {
+    float m_Angle;
+    float m_Damage;
+};
+
+// Fires a shot many times against a snapshot of the board, with the
+// weapon's spread and damage variance, and reports the mean damage dealt to
+// the target. Angles are snapped to buckets and results are cached per
+// (board hash, weapon, boost, bucket), so asking again is a lookup. The cache
+// is a fixed open-addressed table, allocated by Reserve or on first use and
+// never grown; when a key's probe run is full it replaces the entry in its
+// home slot.
+//
+// Samples are split into a fixed number of chunks with their own seeds, so
+// the answer does not depend on whether a pool is used or how big it is.
+// Do not pass a pool when calling from one of that pool's own workers.
+class ShotEvaluator {
+public:
+    // Pellets traced per query, rounded up to whole shots per chunk.
+    static constexpr Dimension DefaultSamples = 256;
+    static constexpr Dimension AngleBuckets = 1024;
+    static constexpr Dimension Chunks = 8;
+    // Must be a power of two.
+    static constexpr std::size_t CacheSize = 1 << 16;
+    static constexpr std::size_t CacheProbes = 8;
+
+private:
+    struct CacheEntry {
+        std::uint64_t m_Key;
+        float m_Damage;
+        bool m_Used;
+    };
+
+    ThreadPool* m_Pool;
+    Dimension m_Samples;
+
+    std::mutex m_Mutex;
+    std::vector<CacheEntry> m_Cache;
+    std::size_t m_Cached{};
+
+    bool Lookup(std::uint64_t key, float& damage);
+    void Store(std::uint64_t key, float damage);
+
+    static float Sample(const Board& board, const ShotQuery& query, std::uint64_t seed, Dimension shots);
+
+public:
+    explicit ShotEvaluator(ThreadPool* pool = nullptr, Dimension samples = DefaultSamples);
+
+    static float SnapAngle(float angle);
+
+    float ExpectedDamage(const Board& board, const ShotQuery& query);
+    // Tries angles across the target square, centre first, and keeps the best.
+    ShotEstimate Aim(const Board& board, ShotQuery query, Dimension target_x, Dimension target_y);
+
+    // Allocates the cache up front, so the first query does not.
+    void Reserve();
+    void Clear();
+    [[nodiscard]] std::size_t Cached();
+};
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+// Turns variable frame times into whole simulation ticks at a fixed rate.
+// Whatever is left over is exposed as `Alpha` for render interpolation.
+class SimClock {
+public:
+    static constexpr Dimension TickRate = 60;
+    static constexpr double TickSeconds = 1.0 / TickRate;
+    // Long stalls (window drags, breakpoints) are dropped rather than replayed.
+    static constexpr double MaxFrameSeconds = 0.25;
+
+private:
+    double m_Accumulator{};
+
+public:
+    void Advance(double seconds);
+    bool Step();
+
+    [[nodiscard]] float Alpha() const { return static_cast<float>(m_Accumulator / TickSeconds); }
+};
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+
+class ThreadPool {
+public:
+    // Batches that can be in flight at once; further ones run on the caller.
+    static constexpr Dimension BatchSlots = 8;
+
+private:
+    // A ForEach call, living on the caller's stack. Indices are claimed
+    // from m_Next by whoever gets there first, caller included.
+    struct Batch {
+        void (*m_Invoke)(void* func, Dimension index);
+        void* m_Func;
+        Dimension m_Count;
+        std::atomic<Dimension> m_Next{};
+        Dimension m_Workers{};
+
+        [[nodiscard]] bool Pending() const { return m_Next.load() < m_Count; }
+        void Run();
+    };
+
+    std::vector<std::thread> m_Workers;
+    std::deque<std::function<void()>> m_Jobs;
+    std::array<Batch*, BatchSlots> m_Batches{};
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::condition_variable m_BatchDone;
+    bool m_Stopping{};
+
+    void Work();
+    Batch* PendingBatch();
+    void RunBatch(Batch& batch);
+
+public:
+    explicit ThreadPool(Dimension threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    [[nodiscard]] Dimension Size() const { return static_cast<Dimension>(m_Workers.size()); }
+
+    template<class F>
+    auto Submit(F&& func) -> std::future<decltype(func())> {
+        auto task = std::make_shared<std::packaged_task<decltype(func())()>>(std::forward<F>(func));
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.emplace_back([task]() { (*task)(); });
+        }
+        m_Condition.notify_one();
+        return future;
+    }
+
+    // Calls func(i) for every i below count, spread over the workers and the
+    // calling thread, and returns once all have finished. Unlike Submit this
+    // goes through fixed batch slots, so it never allocates.
+    template<class F>
+    void ForEach(Dimension count, F&& func) {
+        using Func = std::remove_reference_t<F>;
+        Batch batch;
+        batch.m_Invoke = [](void* f, Dimension index) { (*static_cast<Func*>(f))(index); };
+        batch.m_Func = const_cast<void*>(static_cast<const void*>(std::addressof(func)));
+        batch.m_Count = count;
+        RunBatch(batch);
+    }
+};
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+
+struct TraceResult {
+    Piece m_Piece{Piece::None};
+    Dimension m_X{};
+    Dimension m_Y{};
+    // How far along the segment the hit cell was entered, from 0 to 1.
+    float m_T{1.0f};
+    bool m_Left{};
+};
+
+// The cell containing a pixel coordinate. Projectile kernels must use the
+// same rounding so their same-cell fast path agrees with the traversal.
+inline Dimension PixelToCell(float pixel) {
+    return static_cast<Dimension>(std::floor(std::floor(pixel) / static_cast<float>(Board::SquareScale)));
+}
+
+// Walks every cell the segment crosses in order (Amanatides-Woo) and stops
+// at the first piece that is not `ignore` or a pickup, or where it leaves
+// the board. Coordinates are in pixels.
+TraceResult TraceSegment(const Board& board, float x0, float y0, float x1, float y1, Piece ignore);
+
+// A hitscan shot: traces from the point along `rotation` until it hits or leaves the board.
+TraceResult TraceShot(const Board& board, float x, float y, float rotation, Piece ignore);
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <Search.hpp>
+
+enum class SearchBound {
+    None,
+    Exact,
+    Lower,
+    Upper
+};
+
+struct TranspositionEntry {
+    float m_Score{};
+    Dimension m_Depth{};
+    SearchBound m_Bound{SearchBound::None};
+    SearchMove m_Move{};
+};
+
+// Each slot stores the packed entry next to hash ^ entry. A reader that
+// races a writer sees a pair that fails the check and treats it as a miss,
+// so neither side needs a lock.
+class TranspositionTable {
+public:
+    static constexpr Dimension DefaultBits = 16;
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> m_Check{};
+        std::atomic<std::uint64_t> m_Data{};
+    };
+
+    std::unique_ptr<Slot[]> m_Slots;
+    std::uint64_t m_Mask;
+
+    static std::uint64_t Pack(const TranspositionEntry& entry);
+    static TranspositionEntry Unpack(std::uint64_t data);
+
+public:
+    explicit TranspositionTable(Dimension bits = DefaultBits);
+
+    bool Probe(std::uint64_t hash, TranspositionEntry& entry) const;
+    void Store(std::uint64_t hash, const TranspositionEntry& entry);
+    void Clear();
+
+    [[nodiscard]] std::size_t Size() const { return m_Mask + 1; }
+};
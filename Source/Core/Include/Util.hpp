@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+using Dimension = int;
+static constexpr Dimension DimensionMax = INT_MAX;
+static constexpr Dimension DimensionMin = INT_MIN;
+
+enum class Color {
+    Black,
+    White,
+    Red,
+    Green,
+    Gray,
+    DarkGray,
+    Blue,
+    Yellow,
+    Cyan,
+    Magenta,
+    Orange
+};
+
+template<typename T>
+class Span {
+public:
+    T* m_Data;
+    Dimension m_Size;
+
+public:
+    template<class S>
+    explicit Span(S& container) : m_Data(container.data()), m_Size(container.size()) {}
+
+    T* begin() const { return m_Data; }
+    T* end() const { return m_Data + m_Size; }
+};
+
+template<class T, Dimension Capacity>
+class FixedVector {
+private:
+    std::array<T, Capacity> m_Data{};
+    Dimension m_Size{0};
+
+public:
+    template<class... Args>
+    T& emplace_back(Args&&... args) {
+        if(m_Size >= Capacity) throw std::runtime_error("FixedVector capacity exceeded");
+        return m_Data[m_Size++] = T{std::forward<Args>(args)...};
+    }
+
+    void clear() { m_Size = 0; }
+
+    [[nodiscard]] bool empty() const { return !m_Size; }
+    [[nodiscard]] Dimension size() const { return m_Size; }
+
+    T* data() { return m_Data.data(); }
+    const T* data() const { return m_Data.data(); }
+
+    T* begin() { return m_Data.data(); }
+    T* end() { return m_Data.data() + m_Size; }
+    const T* begin() const { return m_Data.data(); }
+    const T* end() const { return m_Data.data() + m_Size; }
+
+    T& operator[](Dimension index) { return m_Data[index]; }
+    const T& operator[](Dimension index) const { return m_Data[index]; }
+};
+
+bool IsPointInRect(Dimension px, Dimension py, Dimension rx, Dimension ry, Dimension rw, Dimension rh);
+Dimension Centre(Dimension width, Dimension item);
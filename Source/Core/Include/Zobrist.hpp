@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <Bitboard.hpp>
+#include <CWG.hpp>
+
+// Fixed keys, so a hash means the same thing in every run and on every
+// thread. Player state is keyed by the player's piece rather than its slot.
+// Health is keyed on its exact value: positions that only differ by a few
+// points of health must never share a transposition entry.
+class Zobrist {
+public:
+    static constexpr Dimension AmmoKeys = 32;
+    static constexpr Dimension BoostKeys = 8;
+
+private:
+    struct Keys {
+        std::array<std::array<std::uint64_t, MaxBitboardCells>, PieceCount> m_Pieces;
+        std::array<std::uint64_t, PieceCount> m_Health;
+        std::array<std::array<std::uint64_t, AmmoKeys>, PieceCount> m_Ammo;
+        std::array<std::array<std::uint64_t, BoostKeys>, PieceCount> m_Boost;
+        std::array<std::uint64_t, PieceCount> m_ToMove;
+    };
+
+    static const Keys Table;
+
+    static Keys Generate();
+
+public:
+    static std::uint64_t PieceKey(Piece piece, Dimension cell) { return Table.m_Pieces[static_cast<Dimension>(piece)][cell]; }
+    static std::uint64_t ToMoveKey(Piece player) { return Table.m_ToMove[static_cast<Dimension>(player)]; }
+    static std::uint64_t StatsKey(Piece player, float health, Dimension ammo, Dimension boost);
+};
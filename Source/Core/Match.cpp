@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Match.hpp>
+#include <Random.hpp>
+#include <Zobrist.hpp>
+#include <Profiler.hpp>
+
+std::uint64_t Match::SeedStreams(std::uint64_t seed) {
+    Random::Gameplay().Seed(seed);
+    Random::AI().Seed(seed);
+    return seed;
+}
+
+Match::Match(const GameSettings& settings, std::uint64_t seed, ThreadPool* pool) :
+    m_Seed(SeedStreams(seed)),
+    m_Replay(settings, seed),
+    m_Board{},
+    m_Players{
+        Player{
+            settings.m_WhitePiece, settings.m_WhiteWeapon, settings.m_WhiteAI,
+            Board::Width - 1, Board::Height - 1, m_Board,
+            "White", Color::White, Color::Black
+        },
+        Player{
+            settings.m_BlackPiece, settings.m_BlackWeapon, settings.m_BlackAI,
+            0, 0, m_Board,
+            "Black", Color::Black, Color::White
+        }
+    },
+    m_Pickups{
+        Pickup{m_Board},
+        Pickup{m_Board}
+    },
+    m_Shots(pool),
+    m_FramesPerTurn(settings.m_MoveTimer ? FramesPerTurn : 0) {
+    if(m_Players[0].Searches() || m_Players[1].Searches()) {
+        m_Table = std::make_unique<TranspositionTable>();
+        m_Shots.Reserve();
+    }
+}
+
+Player& Match::Current() {
+    return m_Players[m_Turn];
+}
+
+// Projectiles in flight are not part of the hash; they resolve within a
+// few ticks and the search does not model them.
+std::uint64_t Match::Hash() const {
+    return m_Board.Hash() ^ m_Players[0].Hash() ^ m_Players[1].Hash() ^ Zobrist::ToMoveKey(m_Players[m_Turn].m_Piece);
+}
+
+TickResult Match::Tick(const TurnAction& action) {
+    TickResult result{};
+    m_TickArena.Reset();
+
+    Dimension tick = m_Tick;
+    m_Replay.m_Ticks = ++m_Tick;
+
+    auto& player = Current();
+    m_FramesThisTurn++;
+    if(player.m_Dead) {
+        if(++m_Turn >= PlayerCount) m_Turn = 0;
+        return result;
+    }
+
+    if(!m_Moved) {
+        // The search runs against the clock, so AI turns are recorded like human
+        // ones and taken from the input on playback rather than re-thought.
+        TurnAction chosen = player.IsAI() && !m_Playback ? player.ChooseAction(m_Board, Span<Player>(m_Players), m_Table.get(), &m_Shots) : action;
+        if(chosen.m_Kind != ActionKind::None) m_Replay.Record(tick, chosen);
+
+        switch(chosen.m_Kind) {
+            case ActionKind::None: break;
+            case ActionKind::Move: {
+                result.m_Pickup = player.PickupCheck(m_Board, player.m_X + chosen.m_Dx, player.m_Y + chosen.m_Dy, Span<Pickup>(m_Pickups));
+                player.Move(m_Board, chosen.m_Dx, chosen.m_Dy);
+                result.m_Moved = true;
+                break;
+            }
+            case ActionKind::Fire: {
+                result.m_Fired = player.Fire(chosen.m_Rotation, m_Projectiles, m_Turn);
+                if(result.m_Fired) m_Stats.m_Shots[m_Turn]++;
+                break;
+            }
+        }
+        m_Moved = result.m_Moved || result.m_Fired;
+    }
+
+    if((m_FramesThisTurn >= m_FramesPerTurn) && m_Moved) {
+        m_Moved = false;
+        m_FramesThisTurn = 0;
+        if(++m_Turn >= PlayerCount) m_Turn = 0;
+    }
+
+    std::array<Piece, 2> owners{m_Players[0].m_Piece, m_Players[1].m_Piece};
+    ProjectileHits hits{ArenaAllocator<ProjectileHit>(m_TickArena)};
+    {
+        CWG_PROFILE("Projectiles");
+        m_Projectiles.Step(m_Board, Span<const Piece>(owners), hits);
+    }
+
+    for(const ProjectileHit& hit : hits) {
+        auto& fired = m_Players[hit.m_Owner];
+        float damage = WeaponStats::WeaponDamages.at(fired.m_Weapon) + Random::Gameplay().SignedRandRange(WeaponStats::WeaponVariances.at(fired.m_Weapon)) + static_cast<float>(fired.m_DamageBoost);
+        result.m_Hit = true;
+        result.m_Damage = damage;
+        m_Stats.m_Hits[hit.m_Owner]++;
+        m_Stats.m_Damage[hit.m_Owner] += damage;
+        for(auto& other : m_Players) {
+            if(hit.m_Piece == other.m_Piece) {
+                bool death = other.Hurt(damage);
+                if(death) {
+                    other.m_Dead = true;
+                    m_Board.Set(other.m_X, other.m_Y, Piece::None);
+                    m_Dead++;
+                    if(m_Dead >= PlayerCount - 1) {
+                        result.m_Over = true;
+                        result.m_Winner = hit.m_Owner;
+                        return result;
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <MoveTables.hpp>
+
+std::array<std::array<Bitboard, MaxBitboardCells>, PieceCount> MoveTables::Steps{};
+std::array<std::array<Bitboard, MaxBitboardCells>, MoveTables::DirectionCount> MoveTables::Rays{};
+std::array<Dimension, PieceCount> MoveTables::SlideDirections{};
+
+static constexpr std::array<std::pair<Dimension, Dimension>, 8> DirectionSteps {{
+    {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}
+}};
+
+Dimension MoveTables::Direction(Dimension dx, Dimension dy) {
+    std::pair<Dimension, Dimension> step{(dx > 0) - (dx < 0), (dy > 0) - (dy < 0)};
+    return static_cast<Dimension>(std::find(DirectionSteps.begin(), DirectionSteps.end(), step) - DirectionSteps.begin());
+}
+
+// Rays walking towards higher cell indices meet their nearest blocker at the lowest set bit.
+bool MoveTables::IsAscending(Dimension direction) {
+    return DirectionSteps[direction].first + DirectionSteps[direction].second * Board::Width > 0;
+}
+
+void MoveTables::Build() {
+    for(Dimension direction = 0; direction < DirectionCount; ++direction) {
+        for(Dimension cell = 0; cell < Board::Width * Board::Height; ++cell) {
+            Dimension sx = DirectionSteps[direction].first;
+            Dimension sy = DirectionSteps[direction].second;
+
+            Bitboard ray = 0;
+            for(Dimension x = (cell % Board::Width) + sx, y = (cell / Board::Width) + sy; Board::IsInBounds(x, y); x += sx, y += sy) {
+                ray |= CellBit(x + y * Board::Width);
+            }
+            Rays[direction][cell] = ray;
+        }
+    }
+
+    for(Dimension piece = 0; piece < PieceCount; ++piece) {
+        auto moves = PieceMoves(static_cast<Piece>(piece));
+
+        SlideDirections[piece] = 0;
+        for(const PieceMove& move : moves) {
+            if(move.m_Fill) SlideDirections[piece] |= 1 << Direction(move.m_Dx, move.m_Dy);
+        }
+
+        for(Dimension cell = 0; cell < Board::Width * Board::Height; ++cell) {
+            Dimension x = cell % Board::Width;
+            Dimension y = cell / Board::Width;
+
+            Bitboard steps = 0;
+            for(const PieceMove& move : moves) {
+                if(move.m_Fill || !Board::IsInBounds(x + move.m_Dx, y + move.m_Dy)) continue;
+                steps |= CellBit((x + move.m_Dx) + (y + move.m_Dy) * Board::Width);
+            }
+            Steps[piece][cell] = steps;
+        }
+    }
+}
+
+// Boards that keep the default dimensions never go through
+// Board::SetDimensions, so the tables for them are built up front.
+[[maybe_unused]] static const bool DefaultTablesBuilt = (MoveTables::Build(), true);
+
+Bitboard MoveTables::SlideMoves(Piece piece, Dimension cell, Bitboard blockers, Bitboard pickups) {
+    Bitboard targets = 0;
+
+    Dimension directions = SlideDirections[static_cast<Dimension>(piece)];
+    for(Dimension direction = 0; direction < DirectionCount; ++direction) {
+        if(!(directions & (1 << direction))) continue;
+
+        Bitboard ray = Rays[direction][cell];
+        Bitboard stops = ray & (blockers | pickups);
+        if(stops) {
+            Dimension first = IsAscending(direction) ? LowestBit(stops) : HighestBit(stops);
+            ray ^= Rays[direction][first];
+            ray &= ~(blockers & CellBit(first));
+        }
+        targets |= ray;
+    }
+
+    return targets;
+}
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Player.hpp>
+#include <MoveTables.hpp>
+#include <Random.hpp>
+#include <Search.hpp>
+#include <Zobrist.hpp>
+#include <ShotEvaluator.hpp>
+#include <Profiler.hpp>
+
+Player::Player(Piece piece, Weapon weapon, AIStrength ai, Dimension x, Dimension y, Board& board, std::string  name, Color color, Color ammo_color) : m_Name(std::move(name)), m_Piece(piece), m_Weapon(weapon), m_Color(color), m_AmmoColor(ammo_color), m_X(0), m_Y(0), m_AI(ai) {
+    board.Set(m_X, m_Y, Piece::None);
+    Move(board, x, y);
+    m_Ammo = WeaponStats::WeaponAmmos.at(weapon);
+    m_Hash = Zobrist::StatsKey(m_Piece, m_Health, m_Ammo, m_DamageBoost);
+};
+
+void Player::Move(Board& board, Dimension dx, Dimension dy) {
+    board.Set(m_X, m_Y, Piece::None);
+
+    m_X += dx;
+    m_Y += dy;
+    if(!Board::IsInBounds(m_X, m_Y)) throw std::runtime_error("Attempt to move player out of bounds");
+
+    board.Set(m_X, m_Y, m_Piece);
+}
+
+void Player::EnumerateValidPositions(Board& board, Positions& positions) const {
+    positions.clear();
+
+    if(Board::HasBitboards()) {
+        Bitboard targets = ValidTargets(board);
+        while(targets) {
+            Dimension cell = PopLowestBit(targets);
+            positions.emplace_back((cell % Board::Width) - m_X, (cell / Board::Width) - m_Y);
+        }
+
+        return;
+    }
+
+    for(const PieceMove& move : PieceMoves(m_Piece)) {
+        if(!move.m_Fill) {
+            if(!Board::IsInBounds(m_X + move.m_Dx, m_Y + move.m_Dy)) continue;
+
+            Piece at = board.Get(m_X + move.m_Dx, m_Y + move.m_Dy);
+            if(at == Piece::None || IsPickup(at)) {
+                positions.emplace_back(move.m_Dx, move.m_Dy);
+            }
+        }
+        else {
+            Dimension dx = 0;
+            Dimension dy = 0;
+            while(true) {
+                if(move.m_Dx > 0 && dx < move.m_Dx) ++dx;
+                else if(move.m_Dx < 0 && dx > move.m_Dx) --dx;
+                else if(move.m_Dx) break;
+
+                if(move.m_Dy > 0 && dy < move.m_Dy) ++dy;
+                else if(move.m_Dy < 0 && dy > move.m_Dy) --dy;
+                else if(move.m_Dy) break;
+
+                if(!Board::IsInBounds(m_X + dx, m_Y + dy)) break;
+
+                Piece at = board.Get(m_X + dx, m_Y + dy);
+                if(IsPickup(at)) {
+                    positions.emplace_back(dx, dy);
+                    break;
+                }
+                else if(at != Piece::None) break;
+
+                positions.emplace_back(dx, dy);
+            }
+        }
+    }
+}
+
+Bitboard Player::ValidTargets(Board& board) const {
+    Dimension cell = m_X + m_Y * Board::Width;
+    Bitboard blockers = board.Blockers();
+    return (MoveTables::StepMoves(m_Piece, cell) & ~blockers) | MoveTables::SlideMoves(m_Piece, cell, blockers, board.Pickups());
+}
+
+Piece Player::PickupCheck(Board& board, Dimension x, Dimension y, Span<Pickup> pickups) {
+    Piece at = board.Get(x, y);
+    if(at == Piece::AmmoPickup) {
+        SetStats(m_Health, std::min(m_Ammo + 5, WeaponStats::WeaponAmmos.at(m_Weapon)), m_DamageBoost);
+    }
+    else if(at == Piece::HealthPickup) {
+        SetStats(std::min(m_Health + 7.0f, MaxHealth), m_Ammo, m_DamageBoost);
+    }
+    else if(at == Piece::BoostPickup) {
+        SetStats(m_Health, m_Ammo, 5);
+    }
+
+    if(IsPickup(at)) {
+        for(Dimension i = 0; i < pickups.m_Size; ++i) {
+            if(pickups.m_Data[i].m_X == x && pickups.m_Data[i].m_Y == y) {
+                pickups.m_Data[i].Place(board);
+                return at;
+            }
+        }
+        throw std::runtime_error("Invalid pickup at " + std::to_string(x) + " " + std::to_string(y));
+    }
+
+    return Piece::None;
+}
+
+bool Player::Fire(float rotation, ProjectileStore& projectiles, Dimension owner) {
+    if(m_Ammo <= 0) return false;
+
+    Dimension boost = m_DamageBoost;
+    if(boost) boost -= Random::Gameplay().UnsignedRandRange(2);
+    SetStats(m_Health, m_Ammo - 1, std::max(boost, 0));
+    auto x = static_cast<float>(m_X * Board::SquareScale);
+    auto y = static_cast<float>(m_Y * Board::SquareScale);
+    float spread = WeaponStats::WeaponSpreads.at(m_Weapon);
+    for(Dimension i = 0; i < WeaponStats::WeaponCounts.at(m_Weapon); ++i) {
+        projectiles.Spawn(x, y, rotation + Random::Gameplay().SignedRandRange(spread), ProjectileSpeed, owner);
+    }
+
+    return true;
+}
+
+TurnAction Player::ChooseAction(Board& board, Span<Player> players, TranspositionTable* table, ShotEvaluator* shots) const {
+    CWG_PROFILE("AI");
+    if(Searches() && Board::HasBitboards()) {
+        for(Dimension i = 0; i < players.m_Size; ++i) {
+            const Player& other = players.m_Data[i];
+            if(&other == this || other.m_Dead) continue;
+
+            Searcher searcher(SearchLimits::For(m_AI), table);
+            TurnAction action = searcher.Run(SearchState::From(board, *this, other)).m_Action;
+            if(action.m_Kind == ActionKind::Fire && shots) {
+                action.m_Rotation = shots->Aim(board, {m_Piece, other.m_Piece, m_X, m_Y, m_Weapon, m_DamageBoost, 0.0f}, other.m_X, other.m_Y).m_Angle;
+            }
+            return action;
+        }
+    }
+
+    Positions positions;
+    EnumerateValidPositions(board, positions);
+
+    if(Random::AI().UnsignedRandRange(2) && !positions.empty()) {
+        if(Board::HasBitboards()) {
+            Bitboard grab = ValidTargets(board) & board.Pickups();
+            if(grab) {
+                Dimension cell = LowestBit(grab);
+                return {ActionKind::Move, (cell % Board::Width) - m_X, (cell / Board::Width) - m_Y};
+            }
+        }
+        else {
+            for(auto& position : positions) {
+                if(IsPickup(board.Get(m_X + position.first, m_Y + position.second))) {
+                    return {ActionKind::Move, position.first, position.second};
+                }
+            }
+        }
+
+        auto& position = positions[Random::AI().UnsignedRandRange(positions.size())];
+        return {ActionKind::Move, position.first, position.second};
+    }
+
+    if(m_Ammo <= 0) return {};
+
+    if(Random::AI().UnsignedRandRange(2)) {
+        Player& other = players.m_Data[Random::AI().UnsignedRandRange(static_cast<Dimension>(players.m_Size))];
+        Dimension dx = other.m_X - m_X;
+        float rot = atan(static_cast<float>(other.m_Y - m_Y) / static_cast<float>(dx));
+        rot += dx < 0 ? M_PI : 0;
+        return {ActionKind::Fire, 0, 0, rot};
+    }
+
+    return {};
+}
+
+bool Player::Hurt(float damage) {
+    SetStats(m_Health - damage, m_Ammo, m_DamageBoost);
+    return m_Health <= 0.0f;
+}
+
+void Player::SetStats(float health, Dimension ammo, Dimension boost) {
+    m_Hash ^= Zobrist::StatsKey(m_Piece, m_Health, m_Ammo, m_DamageBoost) ^ Zobrist::StatsKey(m_Piece, health, ammo, boost);
+    m_Health = health;
+    m_Ammo = ammo;
+    m_DamageBoost = boost;
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Profiler.hpp>
+
+#ifdef CWG_ALLOCATION_TRACKING
+static thread_local AllocationCount ThreadAllocations{};
+static std::atomic<std::uint64_t> AllAllocations{};
+
+void* operator new(std::size_t size) {
+    ThreadAllocations.m_Count++;
+    AllAllocations.fetch_add(1, std::memory_order_relaxed);
+    ThreadAllocations.m_Bytes += size;
+
+    void* pointer = std::malloc(size ? size : 1);
+    if(!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+// The array and nothrow forms all forward to this one.
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+#endif
+
+Profiler::Profiler() : m_Slots(std::make_unique<Slot[]>(Capacity)), m_Epoch(std::chrono::steady_clock::now()) {}
+
+Profiler& Profiler::Get() {
+    static Profiler profiler{};
+    return profiler;
+}
+
+std::uint32_t Profiler::ThreadIndex() {
+    static std::atomic<std::uint32_t> next{};
+    static thread_local std::uint32_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+AllocationCount Profiler::Allocations() {
+#ifdef CWG_ALLOCATION_TRACKING
+    return ThreadAllocations;
+#else
+    return {};
+#endif
+}
+
+std::uint64_t Profiler::TotalAllocations() {
+#ifdef CWG_ALLOCATION_TRACKING
+    return AllAllocations.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+std::uint64_t Profiler::Now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Epoch).count();
+}
+
+void Profiler::Record(const char* name, std::uint64_t start, std::uint64_t end, AllocationCount allocations) {
+    std::uint64_t index = m_Head.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_Slots[index & (Capacity - 1)];
+
+    slot.m_Sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.m_Sample = {name, start, end - start, ThreadIndex(), allocations};
+    slot.m_Sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+void Profiler::BeginTrace(std::string path) {
+    std::lock_guard<std::mutex> lock(m_TraceMutex);
+    m_TracePath = std::move(path);
+    m_Trace.clear();
+    m_TraceCursor = m_Head.load(std::memory_order_acquire);
+}
+
+void Profiler::PumpTrace() {
+    std::lock_guard<std::mutex> lock(m_TraceMutex);
+    if(!m_TracePath.empty()) Collect(m_TraceCursor, m_Trace);
+}
+
+void Profiler::EndTrace() {
+    std::lock_guard<std::mutex> lock(m_TraceMutex);
+    if(m_TracePath.empty()) return;
+    Collect(m_TraceCursor, m_Trace);
+
+    std::ofstream out(m_TracePath);
+    if(!out) throw std::runtime_error("Failed to open " + m_TracePath);
+
+    // Complete ("X") events, timestamps in microseconds.
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\": [\n";
+    for(std::size_t i = 0; i < m_Trace.size(); ++i) {
+        const ProfileSample& sample = m_Trace[i];
+        out << "  {\"name\": \"" << sample.m_Name << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << sample.m_Thread
+            << ", \"ts\": " << static_cast<double>(sample.m_Start) / 1000.0 << ", \"dur\": " << static_cast<double>(sample.m_Duration) / 1000.0;
+        if(TracksAllocations) out << ", \"args\": {\"allocations\": " << sample.m_Allocations.m_Count << ", \"bytes\": " << sample.m_Allocations.m_Bytes << '}';
+        out << '}' << (i + 1 < m_Trace.size() ? ",\n" : "\n");
+    }
+    out << "], \"displayTimeUnit\": \"ms\"}\n";
+
+    m_TracePath.clear();
+    m_Trace.clear();
+}
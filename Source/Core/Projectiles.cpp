@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Projectiles.hpp>
+#include <Trace.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CWG_SSE2
+#endif
+
+ProjectileStore::ProjectileStore(Dimension capacity) : m_X(capacity), m_Y(capacity), m_PrevX(capacity), m_PrevY(capacity), m_Vx(capacity), m_Vy(capacity), m_Owner(capacity, NoOwner) {
+    m_Free.reserve(capacity);
+}
+
+bool ProjectileStore::Spawn(float x, float y, float rotation, float speed, Dimension owner) {
+    Dimension index;
+    if(!m_Free.empty()) {
+        index = m_Free.back();
+        m_Free.pop_back();
+    }
+    else if(m_High < Capacity()) {
+        index = m_High++;
+    }
+    else {
+        return false;
+    }
+
+    m_X[index] = x;
+    m_Y[index] = y;
+    m_PrevX[index] = x;
+    m_PrevY[index] = y;
+    m_Vx[index] = speed * std::cos(rotation);
+    m_Vy[index] = speed * std::sin(rotation);
+    m_Owner[index] = owner;
+    ++m_Live;
+
+    return true;
+}
+
+void ProjectileStore::Kill(Dimension index) {
+    if(m_Owner[index] == NoOwner) return;
+
+    m_Owner[index] = NoOwner;
+    m_Vx[index] = 0.0f;
+    m_Vy[index] = 0.0f;
+    m_Free.push_back(index);
+    --m_Live;
+}
+
+void ProjectileStore::Clear() {
+    std::fill(m_Owner.begin(), m_Owner.end(), NoOwner);
+    std::fill(m_Vx.begin(), m_Vx.end(), 0.0f);
+    std::fill(m_Vy.begin(), m_Vy.end(), 0.0f);
+    m_Free.clear();
+    m_High = 0;
+    m_Live = 0;
+}
+
+void ProjectileStore::Resolve(Dimension index, bool in_bounds, Piece piece, Span<const Piece> owners, ProjectileHits& hits) {
+    if(!in_bounds) {
+        Kill(index);
+        return;
+    }
+
+    std::int32_t owner = m_Owner[index];
+    if(piece != Piece::None && piece != owners.m_Data[owner] && !IsPickup(piece)) {
+        hits.push_back({owner, piece});
+        Kill(index);
+    }
+}
+
+// Projectiles that cross a cell boundary walk every cell in between, so
+// speed no longer decides whether a piece can be skipped over.
+void ProjectileStore::Sweep(const Board& board, Dimension index, float x0, float y0, Span<const Piece> owners, ProjectileHits& hits) {
+    std::int32_t owner = m_Owner[index];
+    TraceResult trace = TraceSegment(board, x0, y0, m_X[index], m_Y[index], owners.m_Data[owner]);
+    if(trace.m_Piece != Piece::None) {
+        hits.push_back({owner, trace.m_Piece});
+        Kill(index);
+    }
+    else if(trace.m_Left) {
+        Kill(index);
+    }
+}
+
+// The vector kernels compute cells exactly as PixelToCell does. Lanes that
+// stay within one cell only need the end cell, anything else is swept.
+// Cell indices are formed in float, which is exact for any board that fits.
+#if defined(__AVX2__)
+static __m256i PixelToCell8(__m256 pixel, __m256 scale) {
+    return _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_div_ps(_mm256_floor_ps(pixel), scale)));
+}
+
+Dimension ProjectileStore::StepBlocks(const Board& board, Span<const Piece> owners, ProjectileHits& hits) {
+    static_assert(sizeof(Piece) == sizeof(std::int32_t));
+
+    const __m256 scale = _mm256_set1_ps(static_cast<float>(Board::SquareScale));
+    const __m256 width_f = _mm256_set1_ps(static_cast<float>(Board::Width));
+    const __m256i width = _mm256_set1_epi32(Board::Width);
+    const __m256i height = _mm256_set1_epi32(Board::Height);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_cmpeq_epi32(zero, zero);
+    const __m256i no_owner = _mm256_set1_epi32(NoOwner);
+    auto cells = reinterpret_cast<const int*>(board.Cells());
+
+    Dimension i = 0;
+    for(; i + 8 <= m_High; i += 8) {
+        __m256 x0 = _mm256_loadu_ps(&m_X[i]);
+        __m256 y0 = _mm256_loadu_ps(&m_Y[i]);
+        _mm256_storeu_ps(&m_PrevX[i], x0);
+        _mm256_storeu_ps(&m_PrevY[i], y0);
+        __m256 x = _mm256_add_ps(x0, _mm256_loadu_ps(&m_Vx[i]));
+        __m256 y = _mm256_add_ps(y0, _mm256_loadu_ps(&m_Vy[i]));
+        _mm256_storeu_ps(&m_X[i], x);
+        _mm256_storeu_ps(&m_Y[i], y);
+
+        __m256i dead = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&m_Owner[i])), no_owner);
+        if(_mm256_movemask_ps(_mm256_castsi256_ps(dead)) == 0xFF) continue;
+
+        __m256i cx = PixelToCell8(x, scale);
+        __m256i cy = PixelToCell8(y, scale);
+        __m256i same = _mm256_and_si256(_mm256_cmpeq_epi32(cx, PixelToCell8(x0, scale)), _mm256_cmpeq_epi32(cy, PixelToCell8(y0, scale)));
+        __m256i crossed = _mm256_andnot_si256(_mm256_or_si256(dead, same), ones);
+        __m256i stayed = _mm256_andnot_si256(dead, same);
+
+        __m256i in_x = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, cx), _mm256_cmpgt_epi32(width, cx));
+        __m256i in_y = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, cy), _mm256_cmpgt_epi32(height, cy));
+        __m256i in_bounds = _mm256_and_si256(in_x, in_y);
+
+        __m256i lookup = _mm256_and_si256(stayed, in_bounds);
+        __m256i index = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_cvtepi32_ps(cx), _mm256_mul_ps(_mm256_cvtepi32_ps(cy), width_f)));
+        __m256i pieces = _mm256_mask_i32gather_epi32(zero, cells, index, lookup, 4);
+
+        __m256i occupied = _mm256_andnot_si256(_mm256_cmpeq_epi32(pieces, zero), lookup);
+        __m256i left = _mm256_andnot_si256(in_bounds, stayed);
+
+        auto pending = static_cast<Bitboard>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_or_si256(occupied, left), crossed))));
+        if(!pending) continue;
+
+        auto bounds_mask = _mm256_movemask_ps(_mm256_castsi256_ps(in_bounds));
+        auto crossed_mask = _mm256_movemask_ps(_mm256_castsi256_ps(crossed));
+        alignas(32) std::int32_t lane_pieces[8];
+        alignas(32) float lane_x0[8];
+        alignas(32) float lane_y0[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lane_pieces), pieces);
+        _mm256_store_ps(lane_x0, x0);
+        _mm256_store_ps(lane_y0, y0);
+        while(pending) {
+            Dimension lane = PopLowestBit(pending);
+            if((crossed_mask >> lane) & 1) Sweep(board, i + lane, lane_x0[lane], lane_y0[lane], owners, hits);
+            else Resolve(i + lane, (bounds_mask >> lane) & 1, static_cast<Piece>(lane_pieces[lane]), owners, hits);
+        }
+    }
+
+    return i;
+}
+#elif defined(CWG_SSE2)
+// SSE2 has no floor instruction: truncate, then step down where that rounded up.
+static __m128 Floor4(__m128 value) {
+    __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, value), _mm_set1_ps(1.0f)));
+}
+
+static __m128i PixelToCell4(__m128 pixel, __m128 scale) {
+    return _mm_cvttps_epi32(Floor4(_mm_div_ps(Floor4(pixel), scale)));
+}
+
+Dimension ProjectileStore::StepBlocks(const Board& board, Span<const Piece> owners, ProjectileHits& hits) {
+    const __m128 scale = _mm_set1_ps(static_cast<float>(Board::SquareScale));
+    const __m128 width_f = _mm_set1_ps(static_cast<float>(Board::Width));
+    const __m128i width = _mm_set1_epi32(Board::Width);
+    const __m128i height = _mm_set1_epi32(Board::Height);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i no_owner = _mm_set1_epi32(NoOwner);
+    const Piece* cells = board.Cells();
+
+    Dimension i = 0;
+    for(; i + 4 <= m_High; i += 4) {
+        __m128 x0 = _mm_loadu_ps(&m_X[i]);
+        __m128 y0 = _mm_loadu_ps(&m_Y[i]);
+        _mm_storeu_ps(&m_PrevX[i], x0);
+        _mm_storeu_ps(&m_PrevY[i], y0);
+        __m128 x = _mm_add_ps(x0, _mm_loadu_ps(&m_Vx[i]));
+        __m128 y = _mm_add_ps(y0, _mm_loadu_ps(&m_Vy[i]));
+        _mm_storeu_ps(&m_X[i], x);
+        _mm_storeu_ps(&m_Y[i], y);
+
+        __m128i dead = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&m_Owner[i])), no_owner);
+        auto alive = static_cast<Bitboard>(~_mm_movemask_ps(_mm_castsi128_ps(dead)) & 0xF);
+        if(!alive) continue;
+
+        __m128i cx = PixelToCell4(x, scale);
+        __m128i cy = PixelToCell4(y, scale);
+        __m128i same = _mm_and_si128(_mm_cmpeq_epi32(cx, PixelToCell4(x0, scale)), _mm_cmpeq_epi32(cy, PixelToCell4(y0, scale)));
+        auto same_mask = _mm_movemask_ps(_mm_castsi128_ps(same));
+
+        __m128i in_x = _mm_andnot_si128(_mm_cmpgt_epi32(zero, cx), _mm_cmpgt_epi32(width, cx));
+        __m128i in_y = _mm_andnot_si128(_mm_cmpgt_epi32(zero, cy), _mm_cmpgt_epi32(height, cy));
+        auto bounds_mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(in_x, in_y)));
+
+        alignas(16) std::int32_t index[4];
+        alignas(16) float lane_x0[4];
+        alignas(16) float lane_y0[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(index), _mm_cvttps_epi32(_mm_add_ps(_mm_cvtepi32_ps(cx), _mm_mul_ps(_mm_cvtepi32_ps(cy), width_f))));
+        _mm_store_ps(lane_x0, x0);
+        _mm_store_ps(lane_y0, y0);
+
+        // SSE2 has no gather, so only the live lanes touch the mailbox.
+        while(alive) {
+            Dimension lane = PopLowestBit(alive);
+            if(!((same_mask >> lane) & 1)) {
+                Sweep(board, i + lane, lane_x0[lane], lane_y0[lane], owners, hits);
+                continue;
+            }
+
+            bool in_bounds = (bounds_mask >> lane) & 1;
+            Resolve(i + lane, in_bounds, in_bounds ? cells[index[lane]] : Piece::None, owners, hits);
+        }
+    }
+
+    return i;
+}
+#else
+Dimension ProjectileStore::StepBlocks(const Board&, Span<const Piece>, ProjectileHits&) {
+    return 0;
+}
+#endif
+
+void ProjectileStore::Step(const Board& board, Span<const Piece> owners, ProjectileHits& hits) {
+    if(!m_Live) return;
+
+    for(Dimension i = StepBlocks(board, owners, hits); i < m_High; ++i) {
+        float x0 = m_X[i];
+        float y0 = m_Y[i];
+        m_PrevX[i] = x0;
+        m_PrevY[i] = y0;
+        m_X[i] += m_Vx[i];
+        m_Y[i] += m_Vy[i];
+        if(m_Owner[i] == NoOwner) continue;
+
+        Dimension x = PixelToCell(m_X[i]);
+        Dimension y = PixelToCell(m_Y[i]);
+        if(x != PixelToCell(x0) || y != PixelToCell(y0)) {
+            Sweep(board, i, x0, y0, owners, hits);
+            continue;
+        }
+
+        bool in_bounds = Board::IsInBounds(x, y);
+        Resolve(i, in_bounds, in_bounds ? board.Get(x, y) : Piece::None, owners, hits);
+    }
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Random.hpp>
+
+std::uint64_t Random::EntropySeed() {
+    std::random_device device{};
+    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+}
+
+std::uint64_t Random::SplitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+Random& Random::Gameplay() {
+    static thread_local Random random{RandomStream::Gameplay, EntropySeed()};
+    return random;
+}
+
+Random& Random::AI() {
+    static thread_local Random random{RandomStream::AI, EntropySeed()};
+    return random;
+}
+
+Random& Random::Cosmetic() {
+    static thread_local Random random{RandomStream::Cosmetic, EntropySeed()};
+    return random;
+}
+
+Random::Random(RandomStream stream, std::uint64_t seed) : m_Stream(stream) {
+    Seed(seed);
+}
+
+void Random::Seed(std::uint64_t seed) {
+    std::uint64_t state = seed ^ (static_cast<std::uint64_t>(m_Stream) << 56);
+    for(auto& word : m_State) word = SplitMix64(state);
+}
+
+static std::uint64_t RotateLeft(std::uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// xoshiro256**
+std::uint64_t Random::Next() {
+    std::uint64_t result = RotateLeft(m_State[1] * 5, 7) * 9;
+    std::uint64_t t = m_State[1] << 17;
+
+    m_State[2] ^= m_State[0];
+    m_State[3] ^= m_State[1];
+    m_State[1] ^= m_State[2];
+    m_State[0] ^= m_State[3];
+
+    m_State[2] ^= t;
+    m_State[3] = RotateLeft(m_State[3], 45);
+
+    return result;
+}
+
+float Random::SignedRandRange(float range) {
+    float unit = static_cast<float>(Next() >> 40) * 0x1.0p-24f;
+    return (unit * (2 * range)) - range;
+}
+
+Dimension Random::SignedRandRange(Dimension range) {
+    if(range <= 0) return 0;
+    return UnsignedRandRange(2 * range + 1) - range;
+}
+
+Dimension Random::UnsignedRandRange(Dimension range) {
+    if(range <= 0) return 0;
+    return static_cast<Dimension>(((Next() >> 32) * static_cast<std::uint64_t>(range)) >> 32);
+}
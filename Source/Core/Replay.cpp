@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Replay.hpp>
+#include <Match.hpp>
+
+template<class T>
+static void Write(std::ofstream& stream, T value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template<class T>
+static T Read(std::ifstream& stream) {
+    T value{};
+    if(!stream.read(reinterpret_cast<char*>(&value), sizeof(value))) throw std::runtime_error("Truncated replay");
+    return value;
+}
+
+Replay::Replay(const GameSettings& settings, std::uint64_t seed) : m_Seed(seed), m_Width(Board::Width), m_Height(Board::Height), m_Settings(settings) {
+    m_Inputs.reserve(ReservedInputs);
+}
+
+Replay Replay::Load(const std::string& path) {
+    std::ifstream stream(path, std::ios::binary);
+    if(!stream) throw std::runtime_error("Failed to open replay " + path);
+
+    char magic[sizeof(Magic)];
+    if(!stream.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), std::begin(Magic))) throw std::runtime_error("Not a replay " + path);
+    if(Read<std::uint32_t>(stream) != Version) throw std::runtime_error("Unsupported replay version " + path);
+
+    Replay replay{};
+    replay.m_Seed = Read<std::uint64_t>(stream);
+    replay.m_Width = Read<std::int32_t>(stream);
+    replay.m_Height = Read<std::int32_t>(stream);
+
+    replay.m_Settings.m_MoveTimer = Read<std::uint8_t>(stream);
+    replay.m_Settings.m_WhitePiece = static_cast<Piece>(Read<std::uint8_t>(stream));
+    replay.m_Settings.m_WhiteWeapon = static_cast<Weapon>(Read<std::uint8_t>(stream));
+    replay.m_Settings.m_WhiteAI = static_cast<AIStrength>(Read<std::uint8_t>(stream));
+    replay.m_Settings.m_BlackPiece = static_cast<Piece>(Read<std::uint8_t>(stream));
+    replay.m_Settings.m_BlackWeapon = static_cast<Weapon>(Read<std::uint8_t>(stream));
+    replay.m_Settings.m_BlackAI = static_cast<AIStrength>(Read<std::uint8_t>(stream));
+
+    replay.m_Ticks = Read<std::int32_t>(stream);
+    replay.m_Inputs.resize(Read<std::uint32_t>(stream));
+    for(auto& input : replay.m_Inputs) {
+        input.m_Tick = Read<std::int32_t>(stream);
+        input.m_Action.m_Kind = static_cast<ActionKind>(Read<std::uint8_t>(stream));
+        input.m_Action.m_Dx = Read<std::int8_t>(stream);
+        input.m_Action.m_Dy = Read<std::int8_t>(stream);
+        input.m_Action.m_Rotation = Read<float>(stream);
+    }
+
+    return replay;
+}
+
+void Replay::Save(const std::string& path) const {
+    std::ofstream stream(path, std::ios::binary);
+    if(!stream) throw std::runtime_error("Failed to open replay " + path);
+
+    stream.write(Magic, sizeof(Magic));
+    Write<std::uint32_t>(stream, Version);
+
+    Write<std::uint64_t>(stream, m_Seed);
+    Write<std::int32_t>(stream, m_Width);
+    Write<std::int32_t>(stream, m_Height);
+
+    Write<std::uint8_t>(stream, m_Settings.m_MoveTimer);
+    Write<std::uint8_t>(stream, static_cast<std::uint8_t>(m_Settings.m_WhitePiece));
+    Write<std::uint8_t>(stream, static_cast<std::uint8_t>(m_Settings.m_WhiteWeapon));
+    Write<std::uint8_t>(stream, static_cast<std::uint8_t>(m_Settings.m_WhiteAI));
+    Write<std::uint8_t>(stream, static_cast<std::uint8_t>(m_Settings.m_BlackPiece));
+    Write<std::uint8_t>(stream, static_cast<std::uint8_t>(m_Settings.m_BlackWeapon));
+    Write<std::uint8_t>(stream, static_cast<std::uint8_t>(m_Settings.m_BlackAI));
+
+    Write<std::int32_t>(stream, m_Ticks);
+    Write<std::uint32_t>(stream, static_cast<std::uint32_t>(m_Inputs.size()));
+    for(auto& input : m_Inputs) {
+        Write<std::int32_t>(stream, input.m_Tick);
+        Write<std::uint8_t>(stream, static_cast<std::uint8_t>(input.m_Action.m_Kind));
+        Write<std::int8_t>(stream, static_cast<std::int8_t>(input.m_Action.m_Dx));
+        Write<std::int8_t>(stream, static_cast<std::int8_t>(input.m_Action.m_Dy));
+        Write<float>(stream, input.m_Action.m_Rotation);
+    }
+
+    if(!stream) throw std::runtime_error("Failed to write replay " + path);
+}
+
+void Replay::Record(Dimension tick, const TurnAction& action) {
+    m_Inputs.push_back({tick, action});
+}
+
+TurnAction Replay::Input(Dimension tick) {
+    if(m_Cursor < m_Inputs.size() && m_Inputs[m_Cursor].m_Tick == tick) return m_Inputs[m_Cursor++].m_Action;
+    return {};
+}
+
+bool Replay::Finished(Dimension tick) const {
+    return tick >= m_Ticks;
+}
+
+TickResult Replay::Simulate() {
+    Board::SetDimensions(m_Width, m_Height);
+
+    m_Cursor = 0;
+    Match match(m_Settings, m_Seed);
+    match.m_Playback = true;
+
+    TickResult result{};
+    while(!Finished(match.m_Tick)) {
+        result = match.Tick(Input(match.m_Tick));
+        if(result.m_Over) break;
+    }
+
+    return result;
+}
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Search.hpp>
+#include <Player.hpp>
+#include <MoveTables.hpp>
+#include <TranspositionTable.hpp>
+#include <Zobrist.hpp>
+
+static constexpr Dimension PickupAmmo = 5;
+static constexpr float PickupHealth = 7.0f;
+static constexpr Dimension PickupBoost = 5;
+
+// Wins are scored Win - ply from the root; the table stores them relative to
+// the node instead so they stay correct when reached along another path.
+static constexpr float WinThreshold = Searcher::Win - 256.0f;
+
+// The search runs on the game thread, so every budget has to leave room for
+// the rest of a 60 Hz frame. Harder players get deeper limits rather than
+// more time.
+SearchLimits SearchLimits::For(AIStrength strength) {
+    switch(strength) {
+        case AIStrength::Easy: return {4.0, 3};
+        case AIStrength::Normal: return {8.0, 8};
+        case AIStrength::Hard: return {12.0, 32};
+        default: return {0.0, 0};
+    }
+}
+
+static SearchSide SideOf(const Player& player) {
+    return {
+        player.m_Piece,
+        player.m_X + player.m_Y * Board::Width,
+        player.m_Health,
+        player.m_Ammo,
+        WeaponStats::WeaponAmmos.at(player.m_Weapon),
+        player.m_DamageBoost,
+        WeaponStats::WeaponDamages.at(player.m_Weapon),
+        WeaponStats::WeaponSpreads.at(player.m_Weapon),
+        WeaponStats::WeaponCounts.at(player.m_Weapon)
+    };
+}
+
+static std::uint64_t StatsKey(const SearchSide& side) {
+    return Zobrist::StatsKey(side.m_Piece, side.m_Health, side.m_Ammo, side.m_Boost);
+}
+
+static float ToTable(float score, Dimension ply) {
+    if(score > WinThreshold) return score + static_cast<float>(ply);
+    if(score < -WinThreshold) return score - static_cast<float>(ply);
+    return score;
+}
+
+static float FromTable(float score, Dimension ply) {
+    if(score > WinThreshold) return score - static_cast<float>(ply);
+    if(score < -WinThreshold) return score + static_cast<float>(ply);
+    return score;
+}
+
+static void Promote(Searcher::Moves& moves, const SearchMove& move) {
+    auto found = std::find(moves.begin(), moves.end(), move);
+    if(found != moves.end()) std::rotate(moves.begin(), found, found + 1);
+}
+
+SearchState SearchState::From(const Board& board, const Player& self, const Player& other) {
+    SearchState state{
+        {SideOf(self), SideOf(other)},
+        board.Pieces(Piece::AmmoPickup),
+        board.Pieces(Piece::HealthPickup),
+        board.Pieces(Piece::BoostPickup),
+        board.Hash()
+    };
+    state.m_Hash ^= StatsKey(state.m_Sides[0]) ^ StatsKey(state.m_Sides[1]) ^ Zobrist::ToMoveKey(self.m_Piece);
+    return state;
+}
+
+static Bitboard Targets(const SearchSide& mover, const SearchSide& other, Bitboard pickups) {
+    Bitboard blockers = CellBit(mover.m_Cell) | CellBit(other.m_Cell);
+    return (MoveTables::StepMoves(mover.m_Piece, mover.m_Cell) & ~blockers) | MoveTables::SlideMoves(mover.m_Piece, mover.m_Cell, blockers, pickups);
+}
+
+bool Searcher::OutOfTime() {
+    return std::chrono::steady_clock::now() >= m_Deadline;
+}
+
+// Fire first, then pickups, then plain moves: the cheap cut-offs come from
+// the first two.
+void Searcher::Generate(const SearchState& state, Moves& moves) {
+    moves.clear();
+
+    const SearchSide& self = state.m_Sides[0];
+    if(self.m_Ammo > 0) moves.emplace_back(SearchMove{ActionKind::Fire, 0});
+
+    Bitboard pickups = state.Pickups();
+    Bitboard targets = Targets(self, state.m_Sides[1], pickups);
+
+    Bitboard grabs = targets & pickups;
+    while(grabs) moves.emplace_back(SearchMove{ActionKind::Move, PopLowestBit(grabs)});
+
+    Bitboard rest = targets & ~pickups;
+    while(rest) moves.emplace_back(SearchMove{ActionKind::Move, PopLowestBit(rest)});
+}
+
+SearchState Searcher::Apply(const SearchState& state, const SearchMove& move) {
+    SearchState next = state;
+    SearchSide& self = next.m_Sides[0];
+    SearchSide& other = next.m_Sides[1];
+    next.m_Hash ^= StatsKey(self) ^ StatsKey(other) ^ Zobrist::ToMoveKey(self.m_Piece);
+
+    if(move.m_Kind == ActionKind::Fire) {
+        other.m_Health -= ShotValue(self, other);
+        self.m_Ammo--;
+    }
+    else {
+        Bitboard bit = CellBit(move.m_To);
+        Piece pickup = Piece::None;
+        if(next.m_AmmoPickups & bit) {
+            pickup = Piece::AmmoPickup;
+            self.m_Ammo = std::min(self.m_Ammo + PickupAmmo, self.m_MaxAmmo);
+        }
+        else if(next.m_HealthPickups & bit) {
+            pickup = Piece::HealthPickup;
+            self.m_Health = std::min(self.m_Health + PickupHealth, Player::MaxHealth);
+        }
+        else if(next.m_BoostPickups & bit) {
+            pickup = Piece::BoostPickup;
+            self.m_Boost = PickupBoost;
+        }
+
+        next.m_AmmoPickups &= ~bit;
+        next.m_HealthPickups &= ~bit;
+        next.m_BoostPickups &= ~bit;
+        next.m_Hash ^= Zobrist::PieceKey(pickup, move.m_To) ^ Zobrist::PieceKey(self.m_Piece, self.m_Cell) ^ Zobrist::PieceKey(self.m_Piece, move.m_To);
+        self.m_Cell = move.m_To;
+    }
+
+    next.m_Hash ^= StatsKey(self) ^ StatsKey(other) ^ Zobrist::ToMoveKey(other.m_Piece);
+    std::swap(self, other);
+    return next;
+}
+
+// Pellets spread uniformly over [-spread, spread]; the fraction that lands is
+// roughly the angle the target square subtends over the width of the cone.
+float Searcher::ShotValue(const SearchSide& shooter, const SearchSide& target) {
+    auto dx = static_cast<float>((target.m_Cell % Board::Width - shooter.m_Cell % Board::Width) * Board::SquareScale);
+    auto dy = static_cast<float>((target.m_Cell / Board::Width - shooter.m_Cell / Board::Width) * Board::SquareScale);
+    float distance = std::sqrt(dx * dx + dy * dy);
+
+    float fraction = 1.0f;
+    if(shooter.m_Spread > 0.0f) {
+        float subtended = 2.0f * std::atan2(static_cast<float>(Board::SquareScale) * 0.5f, distance);
+        fraction = std::min(1.0f, subtended / (2.0f * shooter.m_Spread));
+    }
+
+    float damage = static_cast<float>(shooter.m_Count) * fraction * (shooter.m_Damage + static_cast<float>(shooter.m_Boost));
+    return std::min(damage, target.m_Health);
+}
+
+float Searcher::Evaluate(const SearchState& state) {
+    const SearchSide& self = state.m_Sides[0];
+    const SearchSide& other = state.m_Sides[1];
+    Bitboard pickups = state.Pickups();
+
+    float threat = (self.m_Ammo > 0 ? ShotValue(self, other) : 0.0f) - (other.m_Ammo > 0 ? ShotValue(other, self) : 0.0f);
+    auto ammo = static_cast<float>(std::min(self.m_Ammo, PickupAmmo) - std::min(other.m_Ammo, PickupAmmo));
+    auto mobility = static_cast<float>(BitCount(Targets(self, other, pickups)) - BitCount(Targets(other, self, pickups)));
+
+    return (self.m_Health - other.m_Health) + 0.5f * threat + ammo + 0.25f * mobility;
+}
+
+float Searcher::Negamax(const SearchState& state, Dimension depth, float alpha, float beta, Dimension ply) {
+    if(depth == 0) return Evaluate(state);
+
+    if((++m_Nodes & 1023) == 0 && OutOfTime()) m_Stopped = true;
+    if(m_Stopped) return 0.0f;
+
+    SearchMove hint{};
+    TranspositionEntry entry{};
+    if(m_Table && m_Table->Probe(state.m_Hash, entry)) {
+        hint = entry.m_Move;
+        if(entry.m_Depth >= depth) {
+            float score = FromTable(entry.m_Score, ply);
+            if(entry.m_Bound == SearchBound::Exact) return score;
+            if(entry.m_Bound == SearchBound::Lower && score >= beta) return score;
+            if(entry.m_Bound == SearchBound::Upper && score <= alpha) return score;
+        }
+    }
+
+    Moves moves;
+    Generate(state, moves);
+    if(moves.empty()) return Evaluate(state);
+    Promote(moves, hint);
+
+    float original_alpha = alpha;
+    float best = -2.0f * Win;
+    SearchMove best_move = moves[0];
+    for(const SearchMove& move : moves) {
+        SearchState next = Apply(state, move);
+        float score = next.m_Sides[0].m_Health <= 0.0f ? Win - static_cast<float>(ply) : -Negamax(next, depth - 1, -beta, -alpha, ply + 1);
+        if(m_Stopped) return 0.0f;
+
+        if(score > best) {
+            best = score;
+            best_move = move;
+        }
+        alpha = std::max(alpha, score);
+        if(alpha >= beta) break;
+    }
+
+    if(m_Table) {
+        SearchBound bound = best <= original_alpha ? SearchBound::Upper : best >= beta ? SearchBound::Lower : SearchBound::Exact;
+        m_Table->Store(state.m_Hash, {ToTable(best, ply), depth, bound, best_move});
+    }
+
+    return best;
+}
+
+SearchResult Searcher::Run(const SearchState& root) {
+    m_Deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(m_Limits.m_Milliseconds));
+    m_Nodes = 0;
+    m_Stopped = false;
+
+    Moves moves;
+    Generate(root, moves);
+    if(moves.empty()) return {};
+
+    // Positions repeat constantly, so last turn's search has usually already
+    // visited this one and its best move is the best first guess.
+    TranspositionEntry entry{};
+    if(m_Table && m_Table->Probe(root.m_Hash, entry)) Promote(moves, entry.m_Move);
+
+    SearchResult result{};
+    SearchMove best = moves[0];
+
+    for(Dimension depth = 1; depth <= m_Limits.m_MaxDepth; ++depth) {
+        float alpha = -2.0f * Win;
+        Dimension best_index = 0;
+
+        for(Dimension i = 0; i < moves.size(); ++i) {
+            SearchState next = Apply(root, moves[i]);
+            float score = next.m_Sides[0].m_Health <= 0.0f ? Win : -Negamax(next, depth - 1, -2.0f * Win, -alpha, 1);
+            if(m_Stopped) break;
+
+            if(score > alpha) {
+                alpha = score;
+                best_index = i;
+            }
+        }
+        if(m_Stopped) break;
+
+        // The previous best goes first next time round, which is most of what
+        // makes deepening cheaper than it looks.
+        best = moves[best_index];
+        std::swap(moves[0], moves[best_index]);
+        result.m_Score = alpha;
+        result.m_Depth = depth;
+        if(m_Table) m_Table->Store(root.m_Hash, {alpha, depth, SearchBound::Exact, best});
+
+        if(alpha >= Win - static_cast<float>(depth) || OutOfTime()) break;
+    }
+
+    result.m_Nodes = m_Nodes;
+
+    const SearchSide& self = root.m_Sides[0];
+    Dimension x = self.m_Cell % Board::Width;
+    Dimension y = self.m_Cell / Board::Width;
+    if(best.m_Kind == ActionKind::Move) {
+        result.m_Action = {ActionKind::Move, best.m_To % Board::Width - x, best.m_To / Board::Width - y};
+    }
+    else {
+        const SearchSide& other = root.m_Sides[1];
+        auto dx = static_cast<float>(other.m_Cell % Board::Width - x);
+        auto dy = static_cast<float>(other.m_Cell / Board::Width - y);
+        result.m_Action = {ActionKind::Fire, 0, 0, std::atan2(dy, dx)};
+    }
+
+    return result;
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <ShotEvaluator.hpp>
+#include <ThreadPool.hpp>
+#include <Random.hpp>
+#include <Trace.hpp>
+
+static constexpr Dimension AimSteps = 3;
+static constexpr float Tau = 2.0f * static_cast<float>(M_PI);
+
+ShotEvaluator::ShotEvaluator(ThreadPool* pool, Dimension samples) : m_Pool(pool), m_Samples(samples) {}
+
+static Dimension Bucket(float angle) {
+    float turns = angle / Tau;
+    turns -= std::floor(turns);
+    return static_cast<Dimension>(std::lround(turns * ShotEvaluator::AngleBuckets)) % ShotEvaluator::AngleBuckets;
+}
+
+float ShotEvaluator::SnapAngle(float angle) {
+    return static_cast<float>(Bucket(angle)) * (Tau / static_cast<float>(AngleBuckets));
+}
+
+float ShotEvaluator::Sample(const Board& board, const ShotQuery& query, std::uint64_t seed, Dimension shots) {
+    Random random(RandomStream::AI, seed);
+
+    // Projectiles leave from the shooter's corner, as in Player::Fire.
+    auto x = static_cast<float>(query.m_X * Board::SquareScale);
+    auto y = static_cast<float>(query.m_Y * Board::SquareScale);
+    float spread = WeaponStats::WeaponSpreads.at(query.m_Weapon);
+    float damage = WeaponStats::WeaponDamages.at(query.m_Weapon) + static_cast<float>(query.m_Boost);
+    float variance = WeaponStats::WeaponVariances.at(query.m_Weapon);
+    Dimension pellets = WeaponStats::WeaponCounts.at(query.m_Weapon);
+
+    float total = 0.0f;
+    for(Dimension i = 0; i < shots; ++i) {
+        for(Dimension j = 0; j < pellets; ++j) {
+            TraceResult hit = TraceShot(board, x, y, query.m_Angle + random.SignedRandRange(spread), query.m_Shooter);
+            if(hit.m_Piece == query.m_Target) total += damage + random.SignedRandRange(variance);
+        }
+    }
+
+    return total;
+}
+
+float ShotEvaluator::ExpectedDamage(const Board& board, const ShotQuery& query) {
+    ShotQuery snapped = query;
+    snapped.m_Angle = SnapAngle(query.m_Angle);
+
+    std::uint64_t descriptor = static_cast<std::uint64_t>(query.m_Weapon) |
+                               (static_cast<std::uint64_t>(std::clamp(query.m_Boost, 0, 255)) << 8) |
+                               (static_cast<std::uint64_t>(Bucket(query.m_Angle)) << 16) |
+                               (static_cast<std::uint64_t>(query.m_Shooter) << 32) |
+                               (static_cast<std::uint64_t>(query.m_Target) << 40);
+    std::uint64_t key = board.Hash() ^ Random::SplitMix64(descriptor);
+
+    // Without bitboards the board has no hash to key on.
+    bool cacheable = Board::HasBitboards();
+    float cached;
+    if(cacheable && Lookup(key, cached)) return cached;
+
+    Dimension pellets = std::max(WeaponStats::WeaponCounts.at(query.m_Weapon), 1);
+    Dimension per_chunk = std::max((m_Samples + pellets * Chunks - 1) / (pellets * Chunks), 1);
+    float total = 0.0f;
+    if(m_Pool) {
+        std::array<float, Chunks> chunks{};
+        m_Pool->ForEach(Chunks, [&](Dimension i) { chunks[i] = Sample(board, snapped, key + i, per_chunk); });
+        for(float chunk : chunks) total += chunk;
+    }
+    else {
+        for(Dimension i = 0; i < Chunks; ++i) total += Sample(board, snapped, key + i, per_chunk);
+    }
+
+    float expected = total / static_cast<float>(per_chunk * Chunks);
+    if(cacheable) Store(key, expected);
+
+    return expected;
+}
+
+bool ShotEvaluator::Lookup(std::uint64_t key, float& damage) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_Cache.empty()) return false;
+
+    for(std::size_t i = 0; i < CacheProbes; ++i) {
+        const CacheEntry& entry = m_Cache[(key + i) & (CacheSize - 1)];
+        if(!entry.m_Used) return false;
+        if(entry.m_Key == key) {
+            damage = entry.m_Damage;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ShotEvaluator::Store(std::uint64_t key, float damage) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_Cache.empty()) m_Cache.resize(CacheSize);
+
+    CacheEntry* slot = &m_Cache[key & (CacheSize - 1)];
+    for(std::size_t i = 0; i < CacheProbes; ++i) {
+        CacheEntry& entry = m_Cache[(key + i) & (CacheSize - 1)];
+        if(!entry.m_Used || entry.m_Key == key) {
+            slot = &entry;
+            break;
+        }
+    }
+
+    if(!slot->m_Used) m_Cached++;
+    *slot = {key, damage, true};
+}
+
+ShotEstimate ShotEvaluator::Aim(const Board& board, ShotQuery query, Dimension target_x, Dimension target_y) {
+    float dx = (static_cast<float>(target_x - query.m_X) + 0.5f) * static_cast<float>(Board::SquareScale);
+    float dy = (static_cast<float>(target_y - query.m_Y) + 0.5f) * static_cast<float>(Board::SquareScale);
+    float centre = std::atan2(dy, dx);
+    float half_width = std::atan2(static_cast<float>(Board::SquareScale) * 0.5f, std::sqrt(dx * dx + dy * dy));
+
+    // A weapon that sprays all the way round gains nothing from aiming.
+    Dimension steps = WeaponStats::WeaponSpreads.at(query.m_Weapon) >= static_cast<float>(M_PI) ? 0 : AimSteps;
+
+    ShotEstimate best{SnapAngle(centre), -1.0f};
+    for(Dimension i = 0; i <= 2 * steps; ++i) {
+        // 0, +1, -1, +2, -2, ... so ties keep the angle nearest the centre.
+        Dimension step = (i + 1) / 2 * (i % 2 ? 1 : -1);
+        query.m_Angle = SnapAngle(centre + half_width * static_cast<float>(step) / static_cast<float>(AimSteps));
+
+        float damage = ExpectedDamage(board, query);
+        if(damage > best.m_Damage) best = {query.m_Angle, damage};
+    }
+
+    return best;
+}
+
+void ShotEvaluator::Reserve() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_Cache.empty()) m_Cache.resize(CacheSize);
+}
+
+void ShotEvaluator::Clear() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::fill(m_Cache.begin(), m_Cache.end(), CacheEntry{});
+    m_Cached = 0;
+}
+
+std::size_t ShotEvaluator::Cached() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Cached;
+}
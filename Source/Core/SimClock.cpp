@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <SimClock.hpp>
+
+void SimClock::Advance(double seconds) {
+    m_Accumulator += std::clamp(seconds, 0.0, MaxFrameSeconds);
+}
+
+bool SimClock::Step() {
+    if(m_Accumulator < TickSeconds) return false;
+
+    m_Accumulator -= TickSeconds;
+    return true;
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <ThreadPool.hpp>
+
+ThreadPool::ThreadPool(Dimension threads) {
+    if(threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    for(Dimension i = 0; i < threads; ++i) m_Workers.emplace_back(&ThreadPool::Work, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+    for(auto& worker : m_Workers) worker.join();
+}
+
+void ThreadPool::Batch::Run() {
+    Dimension index;
+    while((index = m_Next.fetch_add(1)) < m_Count) m_Invoke(m_Func, index);
+}
+
+ThreadPool::Batch* ThreadPool::PendingBatch() {
+    for(Batch* batch : m_Batches) {
+        if(batch && batch->Pending()) return batch;
+    }
+    return nullptr;
+}
+
+void ThreadPool::RunBatch(Batch& batch) {
+    auto slot = m_Batches.end();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        slot = std::find(m_Batches.begin(), m_Batches.end(), nullptr);
+        if(slot != m_Batches.end()) *slot = &batch;
+    }
+
+    if(slot == m_Batches.end()) {
+        batch.Run();
+        return;
+    }
+
+    m_Condition.notify_all();
+    batch.Run();
+
+    // Every index is claimed by now, but workers may still be running theirs.
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_BatchDone.wait(lock, [&batch]() { return batch.m_Workers == 0; });
+    *slot = nullptr;
+}
+
+void ThreadPool::Work() {
+    while(true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            Batch* batch = nullptr;
+            m_Condition.wait(lock, [this, &batch]() { return m_Stopping || !m_Jobs.empty() || (batch = PendingBatch()); });
+
+            if(batch) {
+                batch->m_Workers++;
+                lock.unlock();
+                batch->Run();
+                lock.lock();
+                if(--batch->m_Workers == 0) m_BatchDone.notify_all();
+                continue;
+            }
+
+            if(m_Jobs.empty()) return;
+
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+        job();
+    }
+}
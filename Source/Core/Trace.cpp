@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Trace.hpp>
+
+TraceResult TraceSegment(const Board& board, float x0, float y0, float x1, float y1, Piece ignore) {
+    constexpr float Never = std::numeric_limits<float>::infinity();
+    auto scale = static_cast<float>(Board::SquareScale);
+
+    Dimension x = PixelToCell(x0);
+    Dimension y = PixelToCell(y0);
+    Dimension end_x = PixelToCell(x1);
+    Dimension end_y = PixelToCell(y1);
+
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    Dimension step_x = dx > 0.0f ? 1 : dx < 0.0f ? -1 : 0;
+    Dimension step_y = dy > 0.0f ? 1 : dy < 0.0f ? -1 : 0;
+
+    float delta_x = step_x ? scale / std::abs(dx) : Never;
+    float delta_y = step_y ? scale / std::abs(dy) : Never;
+    float next_x = step_x ? (static_cast<float>(x + (step_x > 0)) * scale - x0) / dx : Never;
+    float next_y = step_y ? (static_cast<float>(y + (step_y > 0)) * scale - y0) / dy : Never;
+
+    float t = 0.0f;
+    while(true) {
+        if(!Board::IsInBounds(x, y)) return {Piece::None, x, y, t, true};
+
+        Piece piece = board.Get(x, y);
+        if(piece != Piece::None && piece != ignore && !IsPickup(piece)) return {piece, x, y, t, false};
+
+        if(x == end_x && y == end_y) return {Piece::None, x, y, 1.0f, false};
+
+        if(next_x < next_y) {
+            t = next_x;
+            next_x += delta_x;
+            x += step_x;
+        }
+        else {
+            t = next_y;
+            next_y += delta_y;
+            y += step_y;
+        }
+
+        // Rounding can carry the walk past the end cell without landing on it.
+        if(t > 1.0f) return {Piece::None, x, y, 1.0f, false};
+    }
+}
+
+TraceResult TraceShot(const Board& board, float x, float y, float rotation, Piece ignore) {
+    // Any direction leaves the board within the diagonal, so one segment is enough.
+    auto reach = static_cast<float>((Board::Width + Board::Height) * Board::SquareScale);
+    return TraceSegment(board, x, y, x + reach * std::cos(rotation), y + reach * std::sin(rotation), ignore);
+}
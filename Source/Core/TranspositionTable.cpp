@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <TranspositionTable.hpp>
+
+// Layout: score bits [0, 32), depth [32, 40), bound [40, 42), move kind
+// [42, 44), move target [44, 52). An all-zero word is an empty slot.
+std::uint64_t TranspositionTable::Pack(const TranspositionEntry& entry) {
+    std::uint32_t score;
+    std::memcpy(&score, &entry.m_Score, sizeof(score));
+
+    return std::uint64_t{score} |
+           (static_cast<std::uint64_t>(std::clamp(entry.m_Depth, 0, 255)) << 32) |
+           (static_cast<std::uint64_t>(entry.m_Bound) << 40) |
+           (static_cast<std::uint64_t>(entry.m_Move.m_Kind) << 42) |
+           (static_cast<std::uint64_t>(entry.m_Move.m_To & 0xFF) << 44);
+}
+
+TranspositionEntry TranspositionTable::Unpack(std::uint64_t data) {
+    TranspositionEntry entry{};
+    auto score = static_cast<std::uint32_t>(data);
+    std::memcpy(&entry.m_Score, &score, sizeof(score));
+
+    entry.m_Depth = static_cast<Dimension>((data >> 32) & 0xFF);
+    entry.m_Bound = static_cast<SearchBound>((data >> 40) & 0x3);
+    entry.m_Move.m_Kind = static_cast<ActionKind>((data >> 42) & 0x3);
+    entry.m_Move.m_To = static_cast<Dimension>((data >> 44) & 0xFF);
+    return entry;
+}
+
+TranspositionTable::TranspositionTable(Dimension bits) : m_Slots(std::make_unique<Slot[]>(std::size_t{1} << bits)), m_Mask((std::uint64_t{1} << bits) - 1) {}
+
+bool TranspositionTable::Probe(std::uint64_t hash, TranspositionEntry& entry) const {
+    const Slot& slot = m_Slots[hash & m_Mask];
+    std::uint64_t data = slot.m_Data.load(std::memory_order_relaxed);
+    std::uint64_t check = slot.m_Check.load(std::memory_order_relaxed);
+    if(!data || (check ^ data) != hash) return false;
+
+    entry = Unpack(data);
+    return true;
+}
+
+// Depth-preferred within a position, always-replace across positions: a
+// shallow result for a new position is worth more than a deep one for a
+// position the game has moved on from.
+void TranspositionTable::Store(std::uint64_t hash, const TranspositionEntry& entry) {
+    Slot& slot = m_Slots[hash & m_Mask];
+    std::uint64_t old = slot.m_Data.load(std::memory_order_relaxed);
+    if(old && (slot.m_Check.load(std::memory_order_relaxed) ^ old) == hash && Unpack(old).m_Depth > entry.m_Depth) return;
+
+    std::uint64_t data = Pack(entry);
+    slot.m_Check.store(hash ^ data, std::memory_order_relaxed);
+    slot.m_Data.store(data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::Clear() {
+    for(std::size_t i = 0; i <= m_Mask; ++i) {
+        m_Slots[i].m_Check.store(0, std::memory_order_relaxed);
+        m_Slots[i].m_Data.store(0, std::memory_order_relaxed);
+    }
+}
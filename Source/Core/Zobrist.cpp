@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Zobrist.hpp>
+#include <Random.hpp>
+
+static constexpr std::uint64_t ZobristSeed = 0x43574723B0A2D5ULL;
+
+const Zobrist::Keys Zobrist::Table = Zobrist::Generate();
+
+template<std::size_t N>
+static void Fill(std::array<std::array<std::uint64_t, N>, PieceCount>& keys, std::uint64_t& state) {
+    for(auto& row : keys) {
+        for(auto& key : row) key = Random::SplitMix64(state);
+    }
+}
+
+Zobrist::Keys Zobrist::Generate() {
+    std::uint64_t state = ZobristSeed;
+
+    Keys keys{};
+    Fill(keys.m_Pieces, state);
+    for(auto& key : keys.m_Health) key = Random::SplitMix64(state);
+    Fill(keys.m_Ammo, state);
+    Fill(keys.m_Boost, state);
+    for(auto& key : keys.m_ToMove) key = Random::SplitMix64(state);
+
+    // An empty square contributes nothing, so Board::Set can XOR blindly.
+    keys.m_Pieces[static_cast<Dimension>(Piece::None)].fill(0);
+    return keys;
+}
+
+std::uint64_t Zobrist::StatsKey(Piece player, float health, Dimension ammo, Dimension boost) {
+    auto index = static_cast<Dimension>(player);
+    // Adding zero folds -0.0 into 0.0 so equal healths hash equally.
+    health += 0.0f;
+    std::uint32_t bits{};
+    std::memcpy(&bits, &health, sizeof(bits));
+    std::uint64_t state = Table.m_Health[index] ^ bits;
+    return Random::SplitMix64(state) ^ Table.m_Ammo[index][std::clamp(ammo, 0, AmmoKeys - 1)] ^ Table.m_Boost[index][std::clamp(boost, 0, BoostKeys - 1)];
+}
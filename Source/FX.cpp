@@ -18,8 +18,12 @@ SDL_Color ColorToSDL(Color color) {
         case Color::White: return {255, 255, 255, 255};
         case Color::Red: return {255, 0, 0, 255};
         case Color::Green: return {0, 255, 0, 255};
-        case Color::DarkGray: return {63, 63, 63};
-        case Color::Gray: return {127, 127, 127};
-        case Color::Blue: return {0, 0, 255};
+        case Color::DarkGray: return {63, 63, 63, 255};
+        case Color::Gray: return {127, 127, 127, 255};
+        case Color::Blue: return {0, 0, 255, 255};
+        case Color::Yellow: return {255, 255, 0, 255};
+        case Color::Cyan: return {0, 255, 255, 255};
+        case Color::Magenta: return {255, 0, 255, 255};
+        case Color::Orange: return {255, 127, 0, 255};
     }
 }
@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Frontend.hpp>
+#include <FX.hpp>
+#include <Texture.hpp>
+#include <Context.hpp>
+
+BoardView::BoardView(TextureLoaderWrapper& loader, Context& ctx) : m_PieceTextures{} {
+    m_PieceTextures.insert({Piece::None, Texture::Dummy});
+
+    m_PieceTextures.insert({Piece::WhitePawn, loader.Get("WhitePawn.png", ctx)});
+    m_PieceTextures.insert({Piece::WhiteRook, loader.Get("WhiteRook.png", ctx)});
+    m_PieceTextures.insert({Piece::WhiteBishop, loader.Get("WhiteBishop.png", ctx)});
+    m_PieceTextures.insert({Piece::WhiteKnight, loader.Get("WhiteKnight.png", ctx)});
+    m_PieceTextures.insert({Piece::WhiteKing, loader.Get("WhiteKing.png", ctx)});
+    m_PieceTextures.insert({Piece::WhiteQueen, loader.Get("WhiteQueen.png", ctx)});
+
+    m_PieceTextures.insert({Piece::BlackPawn, loader.Get("BlackPawn.png", ctx)});
+    m_PieceTextures.insert({Piece::BlackRook, loader.Get("BlackRook.png", ctx)});
+    m_PieceTextures.insert({Piece::BlackBishop, loader.Get("BlackBishop.png", ctx)});
+    m_PieceTextures.insert({Piece::BlackKnight, loader.Get("BlackKnight.png", ctx)});
+    m_PieceTextures.insert({Piece::BlackKing, loader.Get("BlackKing.png", ctx)});
+    m_PieceTextures.insert({Piece::BlackQueen, loader.Get("BlackQueen.png", ctx)});
+
+    m_PieceTextures.insert({Piece::AmmoPickup, loader.Get("AmmoPickup.png", ctx)});
+    m_PieceTextures.insert({Piece::HealthPickup, loader.Get("HealthPickup.png", ctx)});
+    m_PieceTextures.insert({Piece::BoostPickup, loader.Get("BoostPickup.png", ctx)});
+}
+
+void BoardView::DrawCell(Context& ctx, const Board& board, Dimension cell) {
+    Dimension i = cell / Board::Width;
+    Dimension j = cell % Board::Width;
+    ctx.DrawRect(j * Board::SquareScale, i * Board::SquareScale, Board::SquareScale, Board::SquareScale, (j + i % 2) % 2 ? Color::Black : Color::White);
+    m_PieceTextures.at(board.Get(j, i)).get().Draw(ctx, j * Board::SquareScale, i * Board::SquareScale, Board::SquareScale, Board::SquareScale);
+}
+
+void BoardView::Draw(Context& ctx, Board& board, Dimension x, Dimension y) {
+    Dimension width = Board::Width * Board::SquareScale;
+    Dimension height = Board::Height * Board::SquareScale;
+
+    bool stale = !m_Layer || !m_Layer->IsValid(ctx, width, height) || m_Board != &board;
+    if(stale) {
+        m_Layer = std::make_unique<RenderTarget>(ctx, width, height);
+        m_Board = &board;
+    }
+
+    if(stale || !board.DirtyCells().empty()) {
+        ctx.BeginTarget(*m_Layer);
+        if(stale) {
+            for(Dimension cell = 0; cell < Board::Width * Board::Height; ++cell) DrawCell(ctx, board, cell);
+        }
+        else {
+            for(Dimension cell : board.DirtyCells()) DrawCell(ctx, board, cell);
+        }
+        ctx.EndTarget();
+    }
+    board.ClearDirty();
+
+    ctx.DrawTarget(*m_Layer, x, y);
+}
+
+WeaponTextures::WeaponTextures(TextureLoaderWrapper& loader, Context& ctx) {
+    m_Textures.insert({Weapon::None, Texture::Dummy});
+
+    m_Textures.insert({Weapon::Grenade, loader.Get("Grenade.png", ctx)});
+    m_Textures.insert({Weapon::Pistol, loader.Get("Pistol.png", ctx)});
+    m_Textures.insert({Weapon::Shotgun, loader.Get("Shotgun.png", ctx)});
+    m_Textures.insert({Weapon::ScienceGun, loader.Get("ScienceGun.png", ctx)});
+    m_Textures.insert({Weapon::Rifle, loader.Get("Rifle.png", ctx)});
+    m_Textures.insert({Weapon::RocketLauncher, loader.Get("RocketLauncher.png", ctx)});
+}
+
+SoundEffects::SoundEffects(SoundEffectLoader& loader) {
+    m_WeaponSounds.insert({Weapon::Grenade, loader.Get("Grenade.wav")});
+    m_WeaponSounds.insert({Weapon::Pistol, loader.Get("Pistol.wav")});
+    m_WeaponSounds.insert({Weapon::Shotgun, loader.Get("Shotgun.wav")});
+    m_WeaponSounds.insert({Weapon::ScienceGun, loader.Get("ScienceGun.wav")});
+    m_WeaponSounds.insert({Weapon::Rifle, loader.Get("Rifle.wav")});
+    m_WeaponSounds.insert({Weapon::RocketLauncher, loader.Get("RocketLauncher.wav")});
+
+    m_PieceSounds.insert({Piece::AmmoPickup, loader.Get("Ammo.wav")});
+    m_PieceSounds.insert({Piece::HealthPickup, loader.Get("Health.wav")});
+    m_PieceSounds.insert({Piece::BoostPickup, loader.Get("Boost.wav")});
+}
+
+TurnAction DoHumanMoves(Context& ctx, Board& board, const Player& player, Dimension dx, Dimension dy) {
+    Player::Positions positions;
+    player.EnumerateValidPositions(board, positions);
+    for(auto& position : positions) {
+        Dimension new_x = player.m_X + position.first;
+        Dimension new_y = player.m_Y + position.second;
+
+        ctx.DrawRect((new_x * Board::SquareScale) + dx, (new_y * Board::SquareScale) + dy, Board::SquareScale / 2, Board::SquareScale / 2, Color::Green);
+
+        auto pos = Context::GetMousePosition();
+
+        if(IsPointInRect(pos.first, pos.second, (new_x * Board::SquareScale) + dx, (new_y * Board::SquareScale) + dy, Board::SquareScale, Board::SquareScale)) {
+            if(ctx.WasMousePressed()) return {ActionKind::Move, position.first, position.second};
+        }
+    }
+
+    return {};
+}
+
+TurnAction DoHumanWeapon(Context& ctx, WeaponTextures& textures, const Player& player, Dimension dx, Dimension dy) {
+    auto pos = Context::GetMousePosition();
+    float rot = atan(static_cast<float>(pos.second - player.m_Y * Board::SquareScale) / static_cast<float>(pos.first - player.m_X * Board::SquareScale));
+    textures.m_Textures.at(player.m_Weapon).get().Draw(ctx, player.m_X * Board::SquareScale + dx, player.m_Y * Board::SquareScale + dy, Board::SquareScale, Board::SquareScale, (rot * 180.0f) / static_cast<float>(M_PI));
+
+    if(player.m_Ammo <= 0 || player.IsAI()) return {};
+
+    if(ctx.WasMousePressed()) {
+        rot += pos.first - player.m_X * Board::SquareScale < 0 ? M_PI : 0;
+        return {ActionKind::Fire, 0, 0, rot};
+    }
+
+    return {};
+}
+
+void DrawProjectiles(Context& ctx, const ProjectileStore& projectiles, Span<const Player> players, Dimension dx, Dimension dy, float alpha) {
+    for(Dimension i = 0; i < projectiles.High(); ++i) {
+        if(!projectiles.IsAlive(i)) continue;
+
+        auto x = static_cast<Dimension>(projectiles.m_PrevX[i] + (projectiles.m_X[i] - projectiles.m_PrevX[i]) * alpha);
+        auto y = static_cast<Dimension>(projectiles.m_PrevY[i] + (projectiles.m_Y[i] - projectiles.m_PrevY[i]) * alpha);
+        const Player& owner = players.m_Data[projectiles.m_Owner[i]];
+        ctx.DrawRect(dx + x, dy + y, ProjectileStore::ProjectileScale, ProjectileStore::ProjectileScale, owner.m_DamageBoost ? Color::Blue : Color::Red);
+    }
+}
+
+// 3x5 glyphs, one bit per pixel with the top-left pixel in the highest bit.
+static constexpr std::uint16_t LetterGlyphs[] = {
+    0b010'101'111'101'101, 0b110'101'110'101'110, 0b011'100'100'100'011, 0b110'101'101'101'110, 0b111'100'110'100'111, 0b111'100'110'100'100, 0b011'100'101'101'011,
+    0b101'101'111'101'101, 0b111'010'010'010'111, 0b001'001'001'101'010, 0b101'101'110'101'101, 0b100'100'100'100'111, 0b101'111'111'101'101, 0b110'101'101'101'101,
+    0b010'101'101'101'010, 0b110'101'110'100'100, 0b010'101'101'110'011, 0b110'101'110'101'101, 0b011'100'010'001'110, 0b111'010'010'010'010, 0b101'101'101'101'111,
+    0b101'101'101'101'010, 0b101'101'111'111'101, 0b101'101'010'101'101, 0b101'101'010'010'010, 0b111'001'010'100'111
+};
+
+static constexpr std::uint16_t DigitGlyphs[] = {
+    0b111'101'101'101'111, 0b010'110'010'010'111, 0b110'001'010'100'111, 0b110'001'010'001'110, 0b101'101'111'001'001,
+    0b111'100'110'001'110, 0b011'100'111'101'111, 0b111'001'010'010'010, 0b111'101'111'101'111, 0b111'101'111'001'110
+};
+
+static constexpr std::uint16_t DotGlyph = 0b000'000'000'000'010;
+
+Color ProfileOverlay::ZoneColor(const char* name) {
+    static constexpr std::pair<const char*, Color> Colors[] = {
+        {"Simulation", Color::Green},
+        {"AI", Color::Orange},
+        {"Projectiles", Color::Yellow},
+        {"BoardDraw", Color::Blue},
+        {"MenuBoard", Color::Blue},
+        {"ProjectileDraw", Color::Cyan},
+        {"HUD", Color::Magenta},
+        {"MenuUI", Color::Magenta},
+        {"Input", Color::Red},
+        {"Present", Color::White},
+        {"Events", Color::DarkGray},
+    };
+
+    for(auto& [zone, color] : Colors) {
+        if(std::strcmp(zone, name) == 0) return color;
+    }
+    return Color::Gray;
+}
+
+void ProfileOverlay::DrawText(Context& ctx, Dimension x, Dimension y, const char* text, Color color) {
+    for(; *text; ++text, x += 4 * GlyphScale) {
+        char c = *text;
+        std::uint16_t glyph = 0;
+        if(c >= 'a' && c <= 'z') glyph = LetterGlyphs[c - 'a'];
+        else if(c >= 'A' && c <= 'Z') glyph = LetterGlyphs[c - 'A'];
+        else if(c >= '0' && c <= '9') glyph = DigitGlyphs[c - '0'];
+        else if(c == '.') glyph = DotGlyph;
+
+        for(Dimension bit = 0; bit < 15; ++bit) {
+            if(glyph & (1 << (14 - bit))) ctx.DrawRect(x + (bit % 3) * GlyphScale, y + (bit / 3) * GlyphScale, GlyphScale, GlyphScale, color);
+        }
+    }
+}
+
+void ProfileOverlay::EndFrame(Context& ctx) {
+    if(ctx.WasKeyPressed(SDL_SCANCODE_F3)) m_Visible = !m_Visible;
+
+    ArenaVector<ProfileSample> samples{ArenaAllocator<ProfileSample>(ctx.m_FrameArena)};
+    Profiler::Get().Collect(m_Cursor, samples);
+    Profiler::Get().PumpTrace();
+
+    for(Phase& phase : m_Phases) {
+        phase.m_Milliseconds *= 1.0 - Smoothing;
+        phase.m_Allocations = 0;
+    }
+    for(const ProfileSample& sample : samples) {
+        auto found = std::find_if(m_Phases.begin(), m_Phases.end(), [&](const Phase& phase) { return std::strcmp(phase.m_Name, sample.m_Name) == 0; });
+        if(found == m_Phases.end()) found = m_Phases.insert(m_Phases.end(), {sample.m_Name, ZoneColor(sample.m_Name), 0.0, 0});
+        found->m_Milliseconds += Smoothing * static_cast<double>(sample.m_Duration) / 1e6;
+        found->m_Allocations += sample.m_Allocations.m_Count;
+    }
+
+    AllocationCount allocations = Profiler::Allocations();
+    m_FrameAllocations = allocations - m_LastAllocations;
+    m_LastAllocations = allocations;
+
+    if(m_Visible) Draw(ctx);
+}
+
+void ProfileOverlay::Draw(Context& ctx) const {
+    static constexpr double Budget = 1000.0 / 60.0;
+    static constexpr Dimension Label = 2 + BarHeight + 4 + LabelChars * 4 * GlyphScale;
+
+    auto marks = [&](Dimension x, Dimension y, std::uint64_t count) {
+        for(Dimension i = 0; i < static_cast<Dimension>(std::min<std::uint64_t>(count, MaxMarks)); ++i) ctx.DrawRect(x + i * 3, y, 2, BarHeight, Color::Red);
+    };
+
+    Dimension rows = static_cast<Dimension>(m_Phases.size()) + 1;
+    Dimension height = rows * (BarHeight + 2) + 2;
+    Dimension y = Context::Height - height;
+    auto budget = Label + static_cast<Dimension>(Budget * PixelsPerMillisecond);
+    Dimension width = budget + 2 * PixelsPerMillisecond + MaxMarks * 3;
+
+    ctx.DrawRect(0, y, width, height, Color::Black);
+    for(Dimension ms = 1; ms * PixelsPerMillisecond < budget - Label + 2 * PixelsPerMillisecond; ++ms) {
+        ctx.DrawRect(Label + ms * PixelsPerMillisecond, y, 1, 2, Color::DarkGray);
+    }
+    ctx.DrawRect(budget, y, 1, height, Color::White);
+
+    DrawText(ctx, 2 + BarHeight + 4, y + 2, "ALLOC", Color::Red);
+    marks(Label + 2, y + 2, m_FrameAllocations.m_Count);
+    for(Dimension i = 0; i < static_cast<Dimension>(m_Phases.size()); ++i) {
+        const Phase& phase = m_Phases[i];
+        Dimension row = y + 2 + (i + 1) * (BarHeight + 2);
+
+        char label[LabelChars + 1];
+        std::snprintf(label, sizeof(label), "%s %.1f", phase.m_Name, phase.m_Milliseconds);
+        ctx.DrawRect(2, row, BarHeight, BarHeight, phase.m_Color);
+        DrawText(ctx, 2 + BarHeight + 4, row, label, Color::White);
+
+        auto bar = std::max(static_cast<Dimension>(phase.m_Milliseconds * PixelsPerMillisecond), 1);
+        ctx.DrawRect(Label, row, bar, BarHeight, phase.m_Color);
+        marks(Label + bar + 2, row, phase.m_Allocations);
+    }
+}
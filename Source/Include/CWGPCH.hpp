@@ -1,14 +0,0 @@
-// SPDX-License-Identifier: GPL-3.0-or-later
-// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
-
-#include <memory>
-#include <stdexcept>
-#include <array>
-#include <string>
-#include <algorithm>
-#include <unordered_map>
-#include <utility>
-#include <vector>
-#include <random>
-#include <cmath>
-#include <climits>
@@ -5,7 +5,11 @@
 
 #include <Util.hpp>
 #include <FX.hpp>
-#include <CWG.hpp>
+#include <SpriteBatch.hpp>
+#include <TextureAtlas.hpp>
+#include <Archive.hpp>
+#include <FrameArena.hpp>
+#include <RenderTarget.hpp>
 
 class Context {
 private:
@@ -15,7 +19,8 @@ private:
     static void RendererDeleter(SDL_Renderer* renderer) { SDL_DestroyRenderer(renderer); };
     using RendererHandle = std::unique_ptr<SDLHandle<SDL_Renderer>, SDLDestructor<SDL_Renderer, RendererDeleter>>;
 
-    static std::random_device RNG;
+    static void SurfaceDeleter(SDL_Surface* surface) { SDL_DestroySurface(surface); };
+    using SurfaceHandle = std::unique_ptr<SDLHandle<SDL_Surface>, SDLDestructor<SDL_Surface, SurfaceDeleter>>;
 
     static constexpr const char Title[] = "Chess with Guns";
 public:
@@ -23,33 +28,53 @@ public:
     static Dimension Width;
     static Dimension Height;
 
-    std::string m_ResourcePath{"Resources/"};
+    Archive m_Archive;
 
     Dimension m_ShakeIntensity = 0;
+    // Scratch memory for the frame being built; reset by `Update`.
+    FrameArena m_FrameArena;
 private:
     WindowHandle m_Window;
+    // Set instead of a window when rendering offscreen.
+    SurfaceHandle m_Target;
     RendererHandle m_Renderer;
 
-    std::unordered_map<SDL_KeyCode, bool> m_KeyStates;
+    TextureAtlas m_Atlas;
+    SpriteBatch m_Batch;
+
+    std::array<bool, SDL_NUM_SCANCODES> m_KeyStates{};
+    std::array<bool, SDL_NUM_SCANCODES> m_KeyPresses{};
     bool m_MouseHeld{};
 
+    RenderTarget* m_Bound{};
+    Dimension m_TargetGeneration{};
+
+    // Offsets a draw by the screen shake; nothing shakes inside a render target.
+    [[nodiscard]] Dimension Shake();
+
     friend class Texture;
+    friend class RenderTarget;
 
 public:
-    Context();
+    explicit Context(bool offscreen = false);
     ~Context();
 
-    static float SignedRandRange(float range);
-    static Dimension SignedRandRange(Dimension range);
-    static Dimension UnsignedRandRange(Dimension range);
-
     bool Update();
+    void Tick();
 
     void SetColor(Color color);
     void Clear(Color color);
     void DrawRect(Dimension x, Dimension y, Dimension w, Dimension h, Color color);
+
+    // Redirects drawing into `target` until the matching `EndTarget`.
+    void BeginTarget(RenderTarget& target);
+    void EndTarget();
+    void DrawTarget(RenderTarget& target, Dimension x, Dimension y);
+    [[nodiscard]] Dimension TargetGeneration() const { return m_TargetGeneration; }
+
     [[nodiscard]] bool IsMouseHeld() const;
     [[nodiscard]] bool WasMousePressed();
+    [[nodiscard]] bool WasKeyPressed(SDL_Scancode key);
     [[nodiscard]] static std::pair<Dimension, Dimension> GetMousePosition();
     void Resize(Dimension width, Dimension height);
 
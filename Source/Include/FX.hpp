@@ -9,16 +9,6 @@
 #include <SDL3/SDL_image.h>
 #include <SDL3/SDL_mixer.h>
 
-enum class Color {
-    Black,
-    White,
-    Red,
-    Green,
-    Gray,
-    DarkGray,
-    Blue
-};
-
 template<class T>
 class SDLHandle {
 public:
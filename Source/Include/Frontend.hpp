@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <Player.hpp>
+#include <SoundEffect.hpp>
+#include <Profiler.hpp>
+#include <RenderTarget.hpp>
+
+class Context;
+class Texture;
+struct TextureLoaderWrapper;
+
+// Keeps the board composited in a render target. Only cells the board
+// reports dirty are redrawn, so an unchanged board costs a single blit.
+class BoardView {
+public:
+    std::unordered_map<Piece, std::reference_wrapper<Texture>> m_PieceTextures;
+
+private:
+    std::unique_ptr<RenderTarget> m_Layer;
+    const Board* m_Board{};
+
+    void DrawCell(Context& ctx, const Board& board, Dimension cell);
+
+public:
+    BoardView(TextureLoaderWrapper& loader, Context& ctx);
+
+    // Consumes the board's dirty cells.
+    void Draw(Context& ctx, Board& board, Dimension x, Dimension y);
+};
+
+class WeaponTextures {
+public:
+    std::unordered_map<Weapon, std::reference_wrapper<Texture>> m_Textures;
+
+    WeaponTextures(TextureLoaderWrapper& loader, Context& ctx);
+};
+
+class SoundEffects {
+public:
+    std::unordered_map<Weapon, std::reference_wrapper<SoundEffect>> m_WeaponSounds;
+    std::unordered_map<Piece, std::reference_wrapper<SoundEffect>> m_PieceSounds;
+
+    SoundEffects(SoundEffectLoader& loader);
+};
+
+// Per-phase frame timings as bars, toggled with F3. Each row is labelled
+// with its zone's name, smoothed milliseconds and a swatch of the zone's
+// fixed colour; rows appear in the order zones were first seen. Ticks mark
+// milliseconds and the long tick the 60 Hz budget. With allocation tracking,
+// red marks after a bar count the phase's allocations last frame and the
+// ALLOC row those of the whole frame.
+class ProfileOverlay {
+public:
+    static constexpr Dimension PixelsPerMillisecond = 16;
+    static constexpr Dimension BarHeight = 10;
+    static constexpr Dimension MaxMarks = 32;
+    static constexpr double Smoothing = 0.1;
+
+    // Labels use a built-in 3x5 pixel font drawn at this scale.
+    static constexpr Dimension GlyphScale = 2;
+    static constexpr Dimension LabelChars = 20;
+
+    struct Phase {
+        const char* m_Name;
+        Color m_Color;
+        double m_Milliseconds;
+        std::uint64_t m_Allocations;
+    };
+
+    std::vector<Phase> m_Phases;
+    AllocationCount m_FrameAllocations{};
+    bool m_Visible{};
+
+private:
+    std::uint64_t m_Cursor{};
+    AllocationCount m_LastAllocations{};
+
+    // Zones keep the same colour from run to run; unknown ones are gray.
+    static Color ZoneColor(const char* name);
+    static void DrawText(Context& ctx, Dimension x, Dimension y, const char* text, Color color);
+
+public:
+    // Call once per frame, just before Context::Update presents it.
+    void EndFrame(Context& ctx);
+    void Draw(Context& ctx) const;
+};
+
+TurnAction DoHumanMoves(Context& ctx, Board& board, const Player& player, Dimension dx, Dimension dy);
+TurnAction DoHumanWeapon(Context& ctx, WeaponTextures& textures, const Player& player, Dimension dx, Dimension dy);
+void DrawProjectiles(Context& ctx, const ProjectileStore& projectiles, Span<const Player> players, Dimension dx, Dimension dy, float alpha);
+
+void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader, SoundEffectLoader& sfx_loader, ProfileOverlay& overlay);
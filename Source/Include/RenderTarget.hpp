@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <FX.hpp>
+
+class Context;
+
+// An offscreen texture to render into with `Context::BeginTarget` and draw
+// back with `Context::DrawTarget`. Some backends drop target contents
+// when the device resets, so owners compare `m_Generation` against
+// `Context::TargetGeneration` to know when to redraw from scratch.
+class RenderTarget {
+private:
+    static void Deleter(SDL_Texture* texture) { SDL_DestroyTexture(texture); };
+    using Handle = std::unique_ptr<SDLHandle<SDL_Texture>, SDLDestructor<SDL_Texture, Deleter>>;
+
+    Handle m_Texture;
+
+    friend class Context;
+
+public:
+    Dimension m_Width;
+    Dimension m_Height;
+    Dimension m_Generation;
+
+public:
+    RenderTarget(Context& ctx, Dimension width, Dimension height);
+
+    [[nodiscard]] bool IsValid(const Context& ctx, Dimension width, Dimension height) const;
+};
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <Util.hpp>
+#include <ResourceLoader.hpp>
 #include <FX.hpp>
 
 class SoundEffect {
@@ -14,11 +15,19 @@ private:
     Handle m_Sound;
 
 public:
+    using Decoded = Handle;
+
+    static Decoded Decode(const std::string& path);
+
     SoundEffect() = default;
 
     SoundEffect(const std::string& path);
+    explicit SoundEffect(Decoded sound);
+    SoundEffect(const Archive& archive, const ArchiveEntry& entry);
+
+    [[nodiscard]] std::size_t Bytes() const;
 
     void Play();
     void Loop(Dimension loops);
 };
-using SoundEffectLoader = ResourceLoader<SoundEffect, 1024>;
+using SoundEffectLoader = ResourceLoader<SoundEffect>;
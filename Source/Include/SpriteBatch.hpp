@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <FX.hpp>
+
+class SpriteBatch {
+private:
+    std::vector<SDL_Vertex> m_Vertices;
+    std::vector<int> m_Indices;
+    SDL_Texture* m_Texture{};
+
+public:
+    Dimension m_DrawCalls{};
+
+public:
+    void Draw(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_FRect& uv, const SDL_FRect& dest, float rotation, SDL_Color color);
+    void Flush(SDL_Renderer* renderer);
+};
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <FX.hpp>
+#include <ResourceLoader.hpp>
 
 class Context;
 class Texture {
@@ -11,8 +12,18 @@ private:
     static void Deleter(SDL_Texture* texture) { SDL_DestroyTexture(texture); };
     using Handle = std::unique_ptr<SDLHandle<SDL_Texture>, SDLDestructor<SDL_Texture, Deleter>>;
 
+    static void SurfaceDeleter(SDL_Surface* surface) { SDL_DestroySurface(surface); };
+    using SurfaceHandle = std::unique_ptr<SDLHandle<SDL_Surface>, SDLDestructor<SDL_Surface, SurfaceDeleter>>;
+
+public:
+    using Decoded = SurfaceHandle;
+
+    static Decoded Decode(const std::string& path);
+
 private:
     Handle m_Texture{};
+    SDL_Texture* m_Page{};
+    SDL_FRect m_UV{};
 
 public:
     static Texture Dummy;
@@ -24,12 +35,17 @@ public:
     Texture() : m_Dummy(true) {};
 
     Texture(const std::string& path, Context& ctx);
+    Texture(Decoded decoded, Context& ctx);
+    Texture(const Archive& archive, const ArchiveEntry& entry, Context& ctx);
+
+    // Atlas-resident textures share the atlas pages and own no memory of their own.
+    [[nodiscard]] std::size_t Bytes() const { return m_Texture ? static_cast<std::size_t>(m_Width) * m_Height * 4 : 0; }
 
     void Draw(Context& ctx, Dimension x, Dimension y, Dimension width, Dimension height);
     void Draw(Context& ctx, Dimension x, Dimension y, Dimension width, Dimension height, float rotation);
 };
 
-using TextureLoader = ResourceLoader<Texture, 1024>;
+using TextureLoader = ResourceLoader<Texture>;
 
 struct TextureLoaderWrapper {
     TextureLoader m_Loader;
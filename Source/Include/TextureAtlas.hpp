@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#pragma once
+
+#include <Util.hpp>
+#include <FX.hpp>
+#include <Archive.hpp>
+
+struct AtlasRegion {
+    Dimension m_Page;
+    SDL_FRect m_UV;
+    Dimension m_Width;
+    Dimension m_Height;
+};
+
+class TextureAtlas {
+private:
+    static void Deleter(SDL_Texture* texture) { SDL_DestroyTexture(texture); };
+    using Handle = std::unique_ptr<SDLHandle<SDL_Texture>, SDLDestructor<SDL_Texture, Deleter>>;
+
+    static constexpr Dimension SolidSize = 4;
+
+private:
+    std::vector<Handle> m_Pages;
+    std::vector<std::pair<Dimension, Dimension>> m_PageSizes;
+    std::unordered_map<std::string, AtlasRegion> m_Regions;
+    AtlasRegion m_Solid{};
+
+    void AddPage(SDL_Renderer* renderer, const void* pixels, Dimension width, Dimension height);
+
+public:
+    void Build(SDL_Renderer* renderer, const Archive& archive);
+
+    [[nodiscard]] const AtlasRegion* Find(const std::string& name) const;
+    [[nodiscard]] const AtlasRegion& Solid() const { return m_Solid; }
+    [[nodiscard]] SDL_Texture* Page(Dimension page) const { return m_Pages[page].get(); }
+};
@@ -8,9 +8,63 @@
 #include <Texture.hpp>
 #include <Elements.hpp>
 #include <Player.hpp>
+#include <Match.hpp>
+#include <Frontend.hpp>
+#include <Random.hpp>
+#include <Replay.hpp>
+#include <ThreadPool.hpp>
+#include <SimClock.hpp>
 #include <SoundEffect.hpp>
+#include <Profiler.hpp>
+
+int main(int argc, char** argv) {
+    std::string replay_path{};
+    std::string trace_path{};
+    bool headless = false;
+
+    for(Dimension i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        if(arg == "--replay" && i + 1 < argc) replay_path = argv[++i];
+        else if(arg == "--trace" && i + 1 < argc) trace_path = argv[++i];
+        else if(arg == "--headless") headless = true;
+    }
+
+    // The menu quits through std::exit, so the trace is written from an exit handler.
+    if(!trace_path.empty()) {
+        Profiler::Get().BeginTrace(trace_path);
+        std::atexit([] {
+            try {
+                Profiler::Get().EndTrace();
+            }
+            catch(const std::exception& e) {
+                std::fprintf(stderr, "%s\n", e.what());
+            }
+        });
+    }
+
+    bool playback = !replay_path.empty();
+    Replay replay{};
+    if(playback) replay = Replay::Load(replay_path);
+
+    if(headless) {
+        if(!playback) {
+            std::fprintf(stderr, "--headless requires --replay <file>\n");
+            return 1;
+        }
+
+        // Headless runs are not tied to the sim clock and go as fast as the CPU allows.
+        auto start = std::chrono::steady_clock::now();
+        TickResult result = replay.Simulate();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if(result.m_Over) std::printf("%s won after %d ticks (%.2f ms)\n", result.m_Winner ? "Black" : "White", replay.m_Ticks, ms);
+        else std::printf("No winner after %d ticks (%.2f ms)\n", replay.m_Ticks, ms);
+        return 0;
+    }
+
+    ThreadPool pool{};
+    ProfileOverlay overlay{};
 
-int main() {
     restart:;
 
     GameSettings settings{};
@@ -19,81 +73,109 @@ int main() {
     Context::Height = 480;
 
     Context ctx{};
-    TextureLoaderWrapper loader(TextureLoader(ctx.m_ResourcePath));
-    SoundEffectLoader sfx_loader(ctx.m_ResourcePath);
+    TextureLoaderWrapper loader(TextureLoader(ctx.m_Archive, &pool));
+    SoundEffectLoader sfx_loader(ctx.m_Archive, &pool);
+    loader.m_Loader.RequestAll(".png");
+    sfx_loader.RequestAll(".wav");
     WeaponTextures weapon_textures(loader, ctx);
     SoundEffects sound_effects(sfx_loader);
 
     settings.m_UISettings.m_TitleScrollers = 15;
-    DoMenu(ctx, settings, loader, sfx_loader);
+    if(playback) settings = replay.m_Settings;
+    else DoMenu(ctx, settings, loader, sfx_loader, overlay);
 
     SoundEffect& next_turn = sfx_loader.Get("Turn.wav");
 	Context::StopSounds();
     next_turn.Play();
 
-    Board::Width = 8;
-    Board::Height = 8;
-
-    Board board(loader, ctx);
-
-    std::array<Player, 2> players {
-        Player{
-            settings.m_WhitePiece, settings.m_WhiteWeapon, settings.m_WhiteAI,
-            Board::Width - 1, Board::Height - 1, board,
-            "White", Color::White, Color::Black
-        },
-        Player{
-            settings.m_BlackPiece, settings.m_BlackWeapon, settings.m_BlackAI,
-            0, 0, board,
-            "Black", Color::Black, Color::White
-        }
-    };
-
-    std::array<Pickup, 2> pickups{
-        Pickup{board},
-        Pickup{board}
-    };
+    if(!playback) sfx_loader.Release("Title.wav");
+    sfx_loader.Evict();
 
-    Dimension turn = 0;
-    Dimension dead = 0;
+    if(playback) Board::SetDimensions(replay.m_Width, replay.m_Height);
+    else Board::SetDimensions(8, 8);
 
-    Dimension frames_per_turn = settings.m_MoveTimer ? 45 : 0;
-    Dimension frames_this_turn = 0;
-    bool moved = false;
+    Match match(settings, playback ? replay.m_Seed : Random::EntropySeed(), &pool);
+    match.m_Playback = playback;
+    std::string record_path = "Replay-" + std::to_string(match.m_Seed) + ".cwgr";
+    BoardView board_view(loader, ctx);
 
 	SoundEffect& game_song = sfx_loader.Get("PawnWithAShotgun.wav");
 	game_song.Loop(-1);
+
+    SimClock sim_clock{};
+    auto last_frame = std::chrono::steady_clock::now();
+    TurnAction pending{};
+    bool finished = false;
+
 	while(ctx.Update()) {
-        ctx.Clear(Color::DarkGray);
+        auto now = std::chrono::steady_clock::now();
+        sim_clock.Advance(std::chrono::duration<double>(now - last_frame).count());
+        last_frame = now;
+
+        TickResult over{};
+        {
+            CWG_PROFILE("Simulation");
+            while(sim_clock.Step()) {
+                TurnAction action{};
+                if(playback) {
+                    if(replay.Finished(match.m_Tick)) {
+                        finished = true;
+                        break;
+                    }
+                    action = replay.Input(match.m_Tick);
+                }
+                else {
+                    action = pending;
+                    pending = {};
+                }
+
+                Weapon weapon = match.Current().m_Weapon;
+                TickResult result = match.Tick(action);
+                ctx.Tick();
+
+                if(settings.m_SFX && result.m_Pickup != Piece::None) sound_effects.m_PieceSounds.at(result.m_Pickup).get().Play();
+                if(settings.m_SFX && result.m_Moved) next_turn.Play();
+                else if(settings.m_SFX && result.m_Fired) sound_effects.m_WeaponSounds.at(weapon).get().Play();
 
-        auto& player = players[turn];
-        frames_this_turn++;
-        if(player.m_Dead) {
-            if(++turn >= players.size()) turn = 0;
-            continue;
+                if(result.m_Hit) ctx.m_ShakeIntensity = static_cast<Dimension>(result.m_Damage);
+
+                if(result.m_Over) {
+                    over = result;
+                    break;
+                }
+            }
         }
+        if(finished) break;
+
+        ctx.Clear(Color::DarkGray);
+
+        auto& player = match.Current();
+
+        Dimension cx = (Board::Width / 2) * Board::SquareScale;
+        Dimension cy = (Board::Height / 2) * Board::SquareScale;
+
+        Dimension pcx = player.m_X * Board::SquareScale;
+        Dimension pcy = player.m_Y * Board::SquareScale;
+
+        Dimension bx = cx - pcx;
+        Dimension by = cy - pcy;
 
         {
-            Dimension cx = (Board::Width / 2) * Board::SquareScale;
-            Dimension cy = (Board::Height / 2) * Board::SquareScale;
-
-            Dimension pcx = player.m_X * Board::SquareScale;
-            Dimension pcy = player.m_Y * Board::SquareScale;
-
-            Dimension bx = cx - pcx;
-            Dimension by = cy - pcy;
-            board.Draw(ctx, bx, by);
-
-            bool did_move = false;
-            bool did_weapon = false;
-            if(!moved) {
-                did_move = player.DoMoves(ctx, board, Span<Pickup>(pickups), sound_effects, bx, by);
-                if(!did_move) did_weapon = player.DoWeapon(ctx, weapon_textures, Span<Player>(players), bx, by);
-                if(settings.m_SFX && did_move) next_turn.Play();
-                else if(settings.m_SFX && did_weapon) sound_effects.m_WeaponSounds.at(player.m_Weapon).get().Play();
-                moved = did_move || did_weapon;
-            }
+            CWG_PROFILE("BoardDraw");
+            board_view.Draw(ctx, match.m_Board, bx, by);
+        }
 
+        // Input is held until a tick consumes it, however many frames that takes.
+        if(!playback && !match.m_Moved && !player.m_Dead) {
+            CWG_PROFILE("Input");
+            TurnAction action{};
+            if(!player.IsAI()) action = DoHumanMoves(ctx, match.m_Board, player, bx, by);
+            if(action.m_Kind == ActionKind::None) action = DoHumanWeapon(ctx, weapon_textures, player, bx, by);
+            if(pending.m_Kind == ActionKind::None) pending = action;
+        }
+
+        {
+            CWG_PROFILE("HUD");
             Dimension health_width = 240;
             Dimension health_height = 32;
             Dimension ammo_padding = 4;
@@ -113,37 +195,22 @@ int main() {
             for(Dimension j = 0; j < player.m_Ammo; ++j) {
                 ctx.DrawRect(health_x + (2 * ammo_padding * j) + ammo_padding, ammo_padding, ammo_padding, health_height - (2 * ammo_padding), player.m_AmmoColor);
             }
+        }
 
-            if((frames_this_turn >= frames_per_turn) && moved) {
-                moved = false;
-                frames_this_turn = 0;
-                if(++turn >= players.size()) turn = 0;
-            }
+        {
+            CWG_PROFILE("ProjectileDraw");
+            DrawProjectiles(ctx, match.m_Projectiles, Span<const Player>(match.m_Players), bx, by, sim_clock.Alpha());
+        }
 
-            for(auto& fired : players) {
-                for(Projectile& projectile : fired.m_Projectiles) {
-                    Piece hit = projectile.DoMove(ctx, board, fired.m_Piece, !!fired.m_DamageBoost, bx, by);
-                    if(hit != Piece::None) {
-                        projectile.m_Shown = false;
-                        float damage = WeaponStats::WeaponDamages[fired.m_Weapon] + Context::SignedRandRange(WeaponStats::WeaponVariances[fired.m_Weapon]) + static_cast<float>(fired.m_DamageBoost);
-                        ctx.m_ShakeIntensity = static_cast<Dimension>(damage);
-                        for(auto& other : players) {
-                            if(hit == other.m_Piece) {
-                                bool death = other.Hurt(damage);
-                                if(death) {
-                                    other.m_Dead = true;
-                                    board.Set(other.m_X, other.m_Y, Piece::None);
-                                    dead++;
-                                    if(dead >= players.size() - 1) {
-                                        Context::Dialog("Game Over", fired.m_Name + " won!");
-                                        goto restart;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+        if(over.m_Over) {
+            if(!playback) match.m_Replay.Save(record_path);
+            Context::Dialog("Game Over", match.m_Players[over.m_Winner].m_Name + " won!");
+            if(playback) return 0;
+            goto restart;
         }
+
+        overlay.EndFrame(ctx);
     }
+
+    if(!playback) match.m_Replay.Save(record_path);
 }
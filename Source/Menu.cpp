@@ -2,6 +2,8 @@
 // Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
 
 #include <CWG.hpp>
+#include <Frontend.hpp>
+#include <Random.hpp>
 #include <Context.hpp>
 #include <Texture.hpp>
 #include <UI.hpp>
@@ -12,15 +14,15 @@ struct MenuScroller {
     Piece m_Piece;
 
     MenuScroller() {
-        if(Context::UnsignedRandRange(2)) {
+        if(Random::Cosmetic().UnsignedRandRange(2)) {
             m_X = Board::Width - 1;
-            m_Y = Context::UnsignedRandRange(Board::Height);
+            m_Y = Random::Cosmetic().UnsignedRandRange(Board::Height);
         }
         else {
-            m_X = Context::UnsignedRandRange(Board::Width);
+            m_X = Random::Cosmetic().UnsignedRandRange(Board::Width);
             m_Y = Board::Height - 1;
         }
-        m_Piece = static_cast<Piece>(Context::UnsignedRandRange(15));
+        m_Piece = static_cast<Piece>(Random::Cosmetic().UnsignedRandRange(15));
     }
 
     void Tick(Dimension x, Dimension y, Board& board) {
@@ -42,6 +44,15 @@ static const std::array<std::string, 7> weapon_paths {
     "RocketLauncher.png"
 };
 
+// Indexed by AIStrength, so the selection maps straight onto the enum.
+static const std::array<std::string, 5> player_paths {
+    "Person.png",
+    "AIRandom.png",
+    "AIEasy.png",
+    "AINormal.png",
+    "AIHard.png"
+};
+
 static const std::array<std::string, 6> black_piece_paths {
     "BlackPawn.png",
     "BlackRook.png",
@@ -60,7 +71,7 @@ static const std::array<std::string, 6> white_piece_paths {
     "WhiteQueen.png"
 };
 
-void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader, SoundEffectLoader& sfx_loader) {
+void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader, SoundEffectLoader& sfx_loader, ProfileOverlay& overlay) {
 
 
 
@@ -84,8 +95,7 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
     Dimension player_select_item_offset = Board::SquareScale / 4;
     Dimension player_select_y = title_y + title_height + (Board::SquareScale / 2);
 
-    Dimension ai_tickbox_scale = Board::SquareScale;
-    Dimension ai_tickbox_offset = Board::SquareScale / 2;
+    Dimension player_kind_offset = Board::SquareScale / 2;
 
 
 
@@ -94,17 +104,17 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
     std::vector<MenuScroller> scrollers;
     scrollers.resize(settings.m_UISettings.m_TitleScrollers);
 
-    Board::Width = (Context::Width / Board::SquareScale) + 3;
-    Board::Height = (Context::Height / Board::SquareScale) + 3;
-    Board menu_board(loader, ctx);
+    Board::SetDimensions((Context::Width / Board::SquareScale) + 3, (Context::Height / Board::SquareScale) + 3);
+    Board menu_board;
+    BoardView menu_view(loader, ctx);
 
     Texture& title = loader.Get("Title.png", ctx);
     SoundEffect& title_song = sfx_loader.Get("Title.wav");
     SoundEffect& next_turn = sfx_loader.Get("Turn.wav");
 
     for(auto& scroller : scrollers) {
-        scroller.m_X = Context::UnsignedRandRange(Board::Width - 1);
-        scroller.m_Y = Context::UnsignedRandRange(Board::Height - 1);
+        scroller.m_X = Random::Cosmetic().UnsignedRandRange(Board::Width - 1);
+        scroller.m_Y = Random::Cosmetic().UnsignedRandRange(Board::Height - 1);
         menu_board.Set(scroller.m_X, scroller.m_Y, scroller.m_Piece);
     }
 
@@ -115,11 +125,11 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
 
     ArrowSelect black_piece_select { player_select_inset, player_select_y, player_select_scale, Span<const std::string>(black_piece_paths), ctx, loader.m_Loader };
     ArrowSelect black_weapon_select { player_select_inset, black_piece_select.m_Y + player_select_scale + player_select_item_offset, player_select_scale, Span<const std::string>(weapon_paths), ctx, loader.m_Loader };
-    Tickbox black_human { player_select_inset + player_select_scale, black_weapon_select.m_Y + player_select_scale + ai_tickbox_offset, ai_tickbox_scale, true, "Person.png", "Computer.png", ctx, loader.m_Loader };
+    ArrowSelect black_player_select { player_select_inset, black_weapon_select.m_Y + player_select_scale + player_kind_offset, player_select_scale, Span<const std::string>(player_paths), ctx, loader.m_Loader };
 
     ArrowSelect white_piece_select { Context::Width - (player_select_scale * 3) - player_select_inset, player_select_y, player_select_scale, Span<const std::string>(white_piece_paths), ctx, loader.m_Loader };
     ArrowSelect white_weapon_select { white_piece_select.m_X, white_piece_select.m_Y + player_select_scale + player_select_item_offset, player_select_scale, Span<const std::string>(weapon_paths), ctx, loader.m_Loader };
-    Tickbox white_human { white_piece_select.m_X + player_select_scale, white_weapon_select.m_Y + player_select_scale + ai_tickbox_offset, ai_tickbox_scale, true, "Person.png", "Computer.png", ctx, loader.m_Loader };
+    ArrowSelect white_player_select { white_piece_select.m_X, white_weapon_select.m_Y + player_select_scale + player_kind_offset, player_select_scale, Span<const std::string>(player_paths), ctx, loader.m_Loader };
 
     Dimension x_off = 0;
     Dimension y_off = 0;
@@ -127,12 +137,14 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
 
     title_song.Loop(-1);
     while(true) {
+        overlay.EndFrame(ctx);
         if(!ctx.Update()) std::exit(0);
 
         ctx.Clear(Color::DarkGray);
 
         {
-            menu_board.Draw(ctx, x_off--, y_off--);
+            CWG_PROFILE("MenuBoard");
+            menu_view.Draw(ctx, menu_board, x_off--, y_off--);
             if(x_off <= -Board::SquareScale) {
                 x_off = 0;
                 for(auto& scroller : scrollers) scroller.Tick(-1, 0, menu_board);
@@ -150,6 +162,7 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
             if(r >= M_PI * 2) r = 0;
         }
 
+        CWG_PROFILE("MenuUI");
         auto pos = Context::GetMousePosition();
         bool pressed = ctx.WasMousePressed();
         if(sfx.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click) {
@@ -163,11 +176,11 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
 
         if(black_piece_select.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
         if(black_weapon_select.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
-        if(black_human.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
+        if(black_player_select.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
 
         if(white_piece_select.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
         if(white_weapon_select.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
-        if(white_human.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
+        if(white_player_select.Update(ctx, pressed, pos.first, pos.second, 0, 0) == UIResult::Click && sfx.m_State) next_turn.Play();
 
         switch(play.Update(ctx, pressed, pos.first, pos.second, 0, 0)) {
             case UIResult::None: {
@@ -188,9 +201,9 @@ void DoMenu(Context& ctx, GameSettings& settings, TextureLoaderWrapper& loader,
 
     settings.m_WhitePiece = static_cast<Piece>(static_cast<Dimension>(Piece::WhitePawn) + (white_piece_select.m_Current % white_piece_paths.size()));
     settings.m_WhiteWeapon = static_cast<Weapon>(white_weapon_select.m_Current % weapon_paths.size());
-    settings.m_WhiteAI = !white_human.m_State;
+    settings.m_WhiteAI = static_cast<AIStrength>(white_player_select.m_Current % player_paths.size());
 
     settings.m_BlackPiece = static_cast<Piece>(static_cast<Dimension>(Piece::BlackPawn) + (black_piece_select.m_Current % black_piece_paths.size()));
     settings.m_BlackWeapon = static_cast<Weapon>(black_weapon_select.m_Current % weapon_paths.size());
-    settings.m_BlackAI = !black_human.m_State;
+    settings.m_BlackAI = static_cast<AIStrength>(black_player_select.m_Current % player_paths.size());
 }
@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <RenderTarget.hpp>
+#include <Context.hpp>
+
+RenderTarget::RenderTarget(Context& ctx, Dimension width, Dimension height) : m_Width(width), m_Height(height), m_Generation(ctx.TargetGeneration()) {
+    SDL_Texture* texture = SDL_CreateTexture(ctx.m_Renderer.get(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, width, height);
+    SDLNullCheck(texture);
+    m_Texture.reset(texture);
+
+    SDLResultCheck(SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND));
+}
+
+bool RenderTarget::IsValid(const Context& ctx, Dimension width, Dimension height) const {
+    return m_Width == width && m_Height == height && m_Generation == ctx.TargetGeneration();
+}
@@ -3,12 +3,41 @@
 
 #include <SoundEffect.hpp>
 
-SoundEffect::SoundEffect(const std::string& path) {
+SoundEffect::Decoded SoundEffect::Decode(const std::string& path) {
     Mix_Chunk* chunk = Mix_LoadWAV(path.c_str());
     SDLNullCheck(chunk);
+    return Decoded(chunk);
+}
+
+SoundEffect::SoundEffect(const std::string& path) : SoundEffect(Decode(path)) {}
+
+SoundEffect::SoundEffect(Decoded sound) : m_Sound(std::move(sound)) {}
+
+// Archived PCM is played in place from the mapping. If the device did not
+// open with the format the archive was packed for, decode the loose file.
+SoundEffect::SoundEffect(const Archive& archive, const ArchiveEntry& entry) {
+    int frequency{};
+    SDL_AudioFormat format{};
+    int channels{};
+    const ArchiveHeader& header = archive.Header();
+    bool matches = Mix_QuerySpec(&frequency, &format, &channels) && static_cast<std::uint32_t>(frequency) == header.m_AudioFrequency && format == header.m_AudioFormat && static_cast<std::uint32_t>(channels) == header.m_AudioChannels;
+
+    if(!matches) {
+        m_Sound = Decode(archive.Directory() + "/" + entry.m_Name);
+        return;
+    }
+
+    auto samples = reinterpret_cast<Uint8*>(const_cast<std::byte*>(archive.Payload(entry)));
+    Mix_Chunk* chunk = Mix_QuickLoad_RAW(samples, static_cast<Uint32>(entry.m_Size));
+    SDLNullCheck(chunk);
     m_Sound.reset(chunk);
 }
 
+std::size_t SoundEffect::Bytes() const {
+    Mix_Chunk* chunk = m_Sound.get();
+    return chunk ? chunk->alen : 0;
+}
+
 void SoundEffect::Play() {
     Mix_PlayChannel(-1, m_Sound.get(), 0);
 }
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <SpriteBatch.hpp>
+
+void SpriteBatch::Draw(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_FRect& uv, const SDL_FRect& dest, float rotation, SDL_Color color) {
+    if(texture != m_Texture) {
+        Flush(renderer);
+        m_Texture = texture;
+    }
+
+    float hw = dest.w / 2.0f;
+    float hh = dest.h / 2.0f;
+    float cx = dest.x + hw;
+    float cy = dest.y + hh;
+
+    float radians = (rotation * static_cast<float>(M_PI)) / 180.0f;
+    float c = cosf(radians);
+    float s = sinf(radians);
+
+    const std::array<SDL_FPoint, 4> corners {{{-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh}}};
+    const std::array<SDL_FPoint, 4> coords {{{uv.x, uv.y}, {uv.x + uv.w, uv.y}, {uv.x + uv.w, uv.y + uv.h}, {uv.x, uv.y + uv.h}}};
+
+    auto base = static_cast<int>(m_Vertices.size());
+    for(Dimension i = 0; i < corners.size(); ++i) {
+        SDL_FPoint position {cx + corners[i].x * c - corners[i].y * s, cy + corners[i].x * s + corners[i].y * c};
+        m_Vertices.push_back(SDL_Vertex{position, color, coords[i]});
+    }
+
+    for(int index : {0, 1, 2, 0, 2, 3}) m_Indices.push_back(base + index);
+}
+
+void SpriteBatch::Flush(SDL_Renderer* renderer) {
+    if(m_Indices.empty()) return;
+
+    SDLResultCheck(SDL_RenderGeometry(renderer, m_Texture, m_Vertices.data(), static_cast<int>(m_Vertices.size()), m_Indices.data(), static_cast<int>(m_Indices.size())));
+    m_DrawCalls++;
+
+    m_Vertices.clear();
+    m_Indices.clear();
+}
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <Match.hpp>
+#include <Profiler.hpp>
+#include <ThreadPool.hpp>
+
+// Checks that a match already under way never touches the heap, for every AI
+// strength and with shot evaluation spread over a thread pool. Exits 1 if
+// any steady-state tick allocated, on any thread.
+
+#ifndef CWG_ALLOCATION_TRACKING
+// Without tracking built into the core, count here so the check still runs.
+// The count is shared, so allocations on pool workers are caught too.
+static std::atomic<std::uint64_t> Allocated{};
+
+void* operator new(std::size_t size) {
+    Allocated.fetch_add(1, std::memory_order_relaxed);
+
+    void* pointer = std::malloc(size ? size : 1);
+    if(!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+#endif
+
+static std::uint64_t Allocations() {
+#ifdef CWG_ALLOCATION_TRACKING
+    return Profiler::TotalAllocations();
+#else
+    return Allocated.load(std::memory_order_relaxed);
+#endif
+}
+
+// Allocates once on each of a batch's tasks and checks that the count sees
+// them all, including those that ran on workers. Each task sleeps so the
+// workers get to claim some before the calling thread takes the lot.
+static bool CountsWorkerAllocations(ThreadPool& pool) {
+    static constexpr Dimension Tasks = 8;
+
+    std::thread::id caller = std::this_thread::get_id();
+    std::atomic<Dimension> on_workers{};
+    std::uint64_t before = Allocations();
+    pool.ForEach(Tasks, [&](Dimension) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        delete new int{};
+        if(std::this_thread::get_id() != caller) on_workers++;
+    });
+    std::uint64_t made = Allocations() - before;
+
+    std::printf("probe    pooled   %8d tasks %6llu allocations, %d on workers\n", Tasks, static_cast<unsigned long long>(made), on_workers.load());
+    return on_workers > 0 && made >= static_cast<std::uint64_t>(Tasks);
+}
+
+// Matches are played out with the move timer, as in the game, so AI turns
+// are spread over frames. Only the ticks after warmup count.
+static constexpr Dimension Warmup = 256;
+static constexpr Dimension MaxTicks = 20000;
+static constexpr Dimension Seeds = 4;
+
+static const std::array<Weapon, 4> Weapons{
+    Weapon::Pistol,
+    Weapon::Shotgun,
+    Weapon::Rifle,
+    Weapon::ScienceGun
+};
+
+static GameSettings MatchSettings(AIStrength ai, Weapon weapon) {
+    GameSettings settings{};
+    settings.m_MoveTimer = true;
+    settings.m_WhitePiece = Piece::WhiteQueen;
+    settings.m_WhiteWeapon = weapon;
+    settings.m_WhiteAI = ai;
+    settings.m_BlackPiece = Piece::BlackKnight;
+    settings.m_BlackWeapon = weapon;
+    settings.m_BlackAI = ai;
+    return settings;
+}
+
+int main() {
+    Board::SetDimensions(8, 8);
+    ThreadPool pool(2);
+
+    static const std::array<std::pair<AIStrength, const char*>, 4> strengths{{
+        {AIStrength::Random, "Random"},
+        {AIStrength::Easy, "Easy"},
+        {AIStrength::Normal, "Normal"},
+        {AIStrength::Hard, "Hard"}
+    }};
+
+    if(!CountsWorkerAllocations(pool)) {
+        std::fprintf(stderr, "Worker allocations are not being counted\n");
+        return 1;
+    }
+
+    bool allocated = false;
+    for(const auto& strength : strengths) {
+        for(ThreadPool* match_pool : {static_cast<ThreadPool*>(nullptr), &pool}) {
+            std::uint64_t ticks = 0;
+            std::uint64_t made = 0;
+            for(Dimension i = 0; i < static_cast<Dimension>(Weapons.size()) * Seeds; ++i) {
+                Match match(MatchSettings(strength.first, Weapons[i % Weapons.size()]), 1000 + i, match_pool);
+
+                bool over = false;
+                for(Dimension tick = 0; tick < Warmup && !over; ++tick) over = match.Tick({}).m_Over;
+
+                std::uint64_t before = Allocations();
+                while(!over && match.m_Tick < MaxTicks) {
+                    over = match.Tick({}).m_Over;
+                    ticks++;
+                }
+                made += Allocations() - before;
+            }
+
+            std::printf("%-8s %-8s %8llu ticks %6llu allocations\n", strength.second, match_pool ? "pooled" : "serial", static_cast<unsigned long long>(ticks), static_cast<unsigned long long>(made));
+            allocated = allocated || made;
+        }
+    }
+
+    return allocated ? 1 : 0;
+}
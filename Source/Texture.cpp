@@ -6,32 +6,43 @@
 
 Texture Texture::Dummy{};
 
-Texture::Texture(const std::string& path, Context& ctx) : m_Dummy(false) {
+Texture::Decoded Texture::Decode(const std::string& path) {
     SDL_Surface* surface = IMG_Load(path.c_str());
     SDLNullCheck(surface);
+    return Decoded(surface);
+}
+
+Texture::Texture(const std::string& path, Context& ctx) : Texture(Decode(path), ctx) {}
+
+Texture::Texture(Decoded decoded, Context& ctx) : m_Dummy(false) {
+    SDL_Surface* surface = decoded.get();
     SDL_Texture* texture = SDL_CreateTextureFromSurface(ctx.m_Renderer.get(), surface);
     SDLNullCheck(texture);
     m_Texture.reset(texture);
+    m_Page = texture;
+    m_UV = {0, 0, 1, 1};
 
     m_Width = surface->w;
     m_Height = surface->h;
+}
 
-    SDL_DestroySurface(surface);
+Texture::Texture(const Archive& archive, const ArchiveEntry& entry, Context& ctx) : m_Dummy(false) {
+    const AtlasRegion* region = ctx.m_Atlas.Find(entry.m_Name);
+    if(!region) throw std::runtime_error(std::string("Resource archive entry is not an atlas sprite: ") + entry.m_Name);
+
+    m_Page = ctx.m_Atlas.Page(region->m_Page);
+    m_UV = region->m_UV;
+    m_Width = region->m_Width;
+    m_Height = region->m_Height;
 }
 
 void Texture::Draw(Context& ctx, Dimension x, Dimension y, Dimension width, Dimension height) {
-    if(!m_Dummy) {
-        SDL_FRect src {0, 0, static_cast<float>(m_Width), static_cast<float>(m_Height)};
-        SDL_FRect dest {static_cast<float>(x + Context::SignedRandRange(ctx.m_ShakeIntensity)), static_cast<float>(y + Context::SignedRandRange(ctx.m_ShakeIntensity)), static_cast<float>(width), static_cast<float>(height)};
-        SDLResultCheck(SDL_RenderTexture(ctx.m_Renderer.get(), m_Texture.get(), &src, &dest));
-    }
+    Draw(ctx, x, y, width, height, 0.0f);
 }
 
 void Texture::Draw(Context& ctx, Dimension x, Dimension y, Dimension width, Dimension height, float rotation) {
     if(!m_Dummy) {
-        SDL_FRect src {0, 0, static_cast<float>(m_Width), static_cast<float>(m_Height)};
-        SDL_FRect dest {static_cast<float>(x + Context::SignedRandRange(ctx.m_ShakeIntensity)), static_cast<float>(y + Context::SignedRandRange(ctx.m_ShakeIntensity)), static_cast<float>(width), static_cast<float>(height)};
-        SDLResultCheck(SDL_RenderTextureRotated(ctx.m_Renderer.get(), m_Texture.get(), &src, &dest, rotation, nullptr, SDL_FLIP_NONE));
+        SDL_FRect dest {static_cast<float>(x + ctx.Shake()), static_cast<float>(y + ctx.Shake()), static_cast<float>(width), static_cast<float>(height)};
+        ctx.m_Batch.Draw(ctx.m_Renderer.get(), m_Page, m_UV, dest, rotation, ColorToSDL(Color::White));
     }
 }
-
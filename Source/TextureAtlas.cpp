@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <TextureAtlas.hpp>
+
+static AtlasRegion EntryRegion(const ArchiveEntry& entry, Dimension page_width, Dimension page_height) {
+    auto width = static_cast<float>(page_width);
+    auto height = static_cast<float>(page_height);
+    SDL_FRect uv {static_cast<float>(entry.m_X) / width, static_cast<float>(entry.m_Y) / height, static_cast<float>(entry.m_Width) / width, static_cast<float>(entry.m_Height) / height};
+    return {static_cast<Dimension>(entry.m_Page), uv, entry.m_Width, entry.m_Height};
+}
+
+// Pixels are uploaded straight from the mapped archive, the surface only wraps them.
+void TextureAtlas::AddPage(SDL_Renderer* renderer, const void* pixels, Dimension width, Dimension height) {
+    SDL_Surface* surface = SDL_CreateSurfaceFrom(const_cast<void*>(pixels), width, height, width * 4, SDL_PIXELFORMAT_RGBA32);
+    SDLNullCheck(surface);
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    SDLNullCheck(texture);
+    SDLResultCheck(SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND));
+
+    m_Pages.emplace_back(texture);
+    m_PageSizes.emplace_back(width, height);
+}
+
+void TextureAtlas::Build(SDL_Renderer* renderer, const Archive& archive) {
+    for(Dimension i = 0; i < archive.EntryCount(); ++i) {
+        const ArchiveEntry& entry = archive.Entry(i);
+        if(entry.m_Kind != ArchiveKind::AtlasPage) continue;
+
+        if(entry.m_Page != m_Pages.size() || entry.m_Size != static_cast<std::uint64_t>(entry.m_Width) * entry.m_Height * 4) throw std::runtime_error("Malformed atlas page in resource archive");
+        AddPage(renderer, archive.Payload(entry), entry.m_Width, entry.m_Height);
+    }
+
+    bool has_solid = false;
+    for(Dimension i = 0; i < archive.EntryCount(); ++i) {
+        const ArchiveEntry& entry = archive.Entry(i);
+        if(entry.m_Kind != ArchiveKind::Sprite && entry.m_Kind != ArchiveKind::Solid) continue;
+        if(entry.m_Page >= m_Pages.size()) throw std::runtime_error("Atlas region refers to a missing page");
+
+        auto size = m_PageSizes[entry.m_Page];
+        AtlasRegion region = EntryRegion(entry, size.first, size.second);
+        if(entry.m_Kind == ArchiveKind::Solid) {
+            m_Solid = region;
+            has_solid = true;
+        }
+        else {
+            m_Regions[entry.m_Name] = region;
+        }
+    }
+
+    // Without an archive textures load from loose files, but rects still need a solid region.
+    if(!has_solid) {
+        std::vector<std::uint32_t> white(SolidSize * SolidSize, 0xFFFFFFFF);
+        AddPage(renderer, white.data(), SolidSize, SolidSize);
+
+        ArchiveEntry solid{};
+        solid.m_Page = static_cast<std::uint32_t>(m_Pages.size()) - 1;
+        solid.m_X = 1;
+        solid.m_Y = 1;
+        solid.m_Width = SolidSize - 2;
+        solid.m_Height = SolidSize - 2;
+        m_Solid = EntryRegion(solid, SolidSize, SolidSize);
+    }
+}
+
+const AtlasRegion* TextureAtlas::Find(const std::string& name) const {
+    auto it = m_Regions.find(name);
+    return it == m_Regions.end() ? nullptr : &it->second;
+}
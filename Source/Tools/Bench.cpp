@@ -0,0 +1,472 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Util.hpp>
+#include <FX.hpp>
+#include <CWG.hpp>
+#include <Context.hpp>
+#include <Texture.hpp>
+#include <Frontend.hpp>
+#include <Match.hpp>
+#include <Random.hpp>
+#include <Profiler.hpp>
+
+// Every run first times a fixed integer workload, and each benchmark is
+// reported and compared as a multiple of it, so a baseline carries over
+// between machines of different speeds. The ratios do not cancel
+// differences in cache, memory or GPU, which is what the tolerance is for.
+//
+// Source/Tools/BenchBaseline.json is the committed reference; compare with
+//     CWGBench --baseline <checkout>/Source/Tools/BenchBaseline.json
+// It was recorded from a Release build with --repetitions 21 on a single
+// virtualised Intel Xeon core. That machine had no display, so it ran with
+// --no-render and the render benchmarks have no reference until the file is
+// next regenerated. After an intended performance change, rebuild in
+// Release, run the CWGBenchBaseline target on an idle machine with a
+// display and commit the rewritten file.
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchSample {
+    double m_Nanoseconds;
+    std::uint64_t m_Operations;
+};
+
+struct Benchmark {
+    std::string m_Name;
+    std::function<BenchSample()> m_Run;
+};
+
+struct BenchResult {
+    std::string m_Name;
+    double m_NanosecondsPerOp;
+    std::uint64_t m_Operations;
+    double m_AllocationsPerOp;
+    // Time per operation as a multiple of the calibration's.
+    double m_Relative{};
+};
+
+struct BenchSettings {
+    Dimension m_Repetitions{7};
+    double m_Tolerance{0.15};
+    std::string m_Filter;
+    std::string m_JSON;
+    std::string m_Baseline;
+    bool m_Render{true};
+};
+
+// Results feed into this so the optimiser cannot drop the work being timed.
+static volatile std::uint64_t Sink;
+
+// Heap allocations made inside Time since Run last reset it; only counted
+// with CWG_ALLOCATION_TRACKING.
+static AllocationCount TimedAllocations;
+
+template<class F>
+static double Time(F&& func) {
+    AllocationCount allocations = Profiler::Allocations();
+    auto start = Clock::now();
+    func();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    AllocationCount made = Profiler::Allocations() - allocations;
+    TimedAllocations.m_Count += made.m_Count;
+    TimedAllocations.m_Bytes += made.m_Bytes;
+    return ns;
+}
+
+// The fixed 8x8 position every board benchmark starts from.
+static void SetupBoard(Board& board) {
+    board.Set(3, 1, Piece::AmmoPickup);
+    board.Set(5, 4, Piece::HealthPickup);
+    board.Set(1, 6, Piece::BoostPickup);
+    board.Set(6, 1, Piece::BlackRook);
+}
+
+// The unit every result is expressed in: a dependent chain of SplitMix64
+// steps, which touches no memory and so tracks the core's speed alone.
+static Benchmark Calibration() {
+    return {"Calibration", []() {
+        static constexpr Dimension Steps = 1 << 20;
+
+        std::uint64_t state = 1;
+        std::uint64_t mixed = 0;
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Steps; ++i) mixed ^= Random::SplitMix64(state);
+        });
+        Sink = Sink + mixed;
+        return BenchSample{ns, Steps};
+    }};
+}
+
+static Benchmark EnumeratePositions(Piece piece, const char* name) {
+    return {std::string("EnumerateValidPositions/") + name, [piece]() {
+        static constexpr Dimension Calls = 100000;
+
+        Board board;
+        SetupBoard(board);
+        Player player(piece, Weapon::Pistol, AIStrength::Human, 3, 4, board, "Bench", Color::White, Color::Black);
+
+        Player::Positions positions;
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Calls; ++i) {
+                player.EnumerateValidPositions(board, positions);
+                Sink = Sink + positions.size();
+            }
+        });
+        return BenchSample{ns, Calls};
+    }};
+}
+
+// Each sample starts from a fresh, fixed spawn and times a run of steps, so
+// the live count stays close to the target throughout.
+static Benchmark ProjectileStep(Dimension count) {
+    return {"ProjectileStep/" + std::to_string(count), [count]() {
+        static constexpr Dimension Steps = 16;
+
+        Board board;
+        SetupBoard(board);
+        board.Set(7, 7, Piece::WhiteQueen);
+        std::array<Piece, 2> owners{Piece::WhiteQueen, Piece::BlackRook};
+
+        ProjectileStore store(count);
+        Random random(RandomStream::Gameplay, 20231);
+        auto extent = static_cast<float>(Board::Width * Board::SquareScale);
+        for(Dimension i = 0; i < count; ++i) {
+            float x = (random.SignedRandRange(0.5f) + 0.5f) * extent;
+            float y = (random.SignedRandRange(0.5f) + 0.5f) * extent;
+            store.Spawn(x, y, random.SignedRandRange(static_cast<float>(M_PI)), 2.0f, i % 2);
+        }
+
+        FrameArena arena(count * sizeof(ProjectileHit));
+        ProjectileHits hits{ArenaAllocator<ProjectileHit>(arena)};
+        hits.reserve(count);
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Steps; ++i) {
+                hits.clear();
+                store.Step(board, Span<const Piece>(owners), hits);
+            }
+        });
+        Sink = Sink + store.Live();
+        return BenchSample{ns, Steps};
+    }};
+}
+
+static GameSettings RandomMatchSettings() {
+    GameSettings settings{};
+    settings.m_MoveTimer = false;
+    settings.m_WhitePiece = Piece::WhiteQueen;
+    settings.m_WhiteWeapon = Weapon::Shotgun;
+    settings.m_WhiteAI = AIStrength::Random;
+    settings.m_BlackPiece = Piece::BlackKnight;
+    settings.m_BlackWeapon = Weapon::Rifle;
+    settings.m_BlackAI = AIStrength::Random;
+    return settings;
+}
+
+static Benchmark MatchThroughput() {
+    return {"MatchTick", []() {
+        static constexpr Dimension Matches = 16;
+        static constexpr Dimension MaxTicks = 20000;
+
+        GameSettings settings = RandomMatchSettings();
+        std::uint64_t ticks = 0;
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Matches; ++i) {
+                Match match(settings, 1000 + i);
+                TickResult result{};
+                while(!result.m_Over && match.m_Tick < MaxTicks) result = match.Tick({});
+                ticks += match.m_Tick;
+            }
+        });
+        return BenchSample{ns, ticks};
+    }};
+}
+
+// Ticks of one match already under way, leaving out setup and teardown.
+static Benchmark MatchSteadyState() {
+    return {"MatchTick/Steady", []() {
+        static constexpr Dimension Warmup = 256;
+        static constexpr Dimension Ticks = 1024;
+
+        Match match(RandomMatchSettings(), 1000);
+        for(Dimension i = 0; i < Warmup; ++i) match.Tick({});
+
+        std::uint64_t ticks = 0;
+        double ns = Time([&]() {
+            for(; ticks < Ticks; ++ticks) {
+                if(match.Tick({}).m_Over) break;
+            }
+        });
+        return BenchSample{ns, ticks};
+    }};
+}
+
+static std::vector<std::string> TextureNames(const Archive& archive) {
+    std::vector<std::string> names;
+    std::error_code error;
+    for(const auto& file : std::filesystem::directory_iterator(archive.Directory(), error)) {
+        if(file.path().extension() == ".png") names.push_back(file.path().filename().string());
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+static void AddRenderBenchmarks(std::vector<Benchmark>& benchmarks, Context& ctx) {
+    std::vector<std::string> names = TextureNames(ctx.m_Archive);
+    if(names.empty()) throw std::runtime_error("No textures found in " + ctx.m_Archive.Directory());
+
+    benchmarks.push_back({"ResourceLoader/Cold", [&ctx, names]() {
+        std::uint64_t bytes = 0;
+        double ns = Time([&]() {
+            TextureLoader loader(ctx.m_Archive);
+            for(const std::string& name : names) bytes += loader.Get(name, ctx).m_Width;
+        });
+        Sink = Sink + bytes;
+        return BenchSample{ns, names.size()};
+    }});
+
+    benchmarks.push_back({"ResourceLoader/Warm", [&ctx, names]() {
+        static constexpr Dimension Passes = 100;
+
+        TextureLoader loader(ctx.m_Archive);
+        for(const std::string& name : names) loader.Get(name, ctx);
+
+        std::uint64_t width = 0;
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Passes; ++i) {
+                for(const std::string& name : names) width += loader.Get(name, ctx).m_Width;
+            }
+        });
+        Sink = Sink + width;
+        return BenchSample{ns, names.size() * Passes};
+    }});
+
+    benchmarks.push_back({"Texture/Decode", [&ctx, names]() {
+        std::uint64_t width = 0;
+        double ns = Time([&]() {
+            for(const std::string& name : names) {
+                Texture::Decoded decoded = Texture::Decode(ctx.m_Archive.Directory() + "/" + name);
+                SDL_Surface* surface = decoded.get();
+                width += surface->w;
+            }
+        });
+        Sink = Sink + width;
+        return BenchSample{ns, names.size()};
+    }});
+
+    benchmarks.push_back({"BoardView/Draw", [&ctx]() {
+        static constexpr Dimension Frames = 100;
+
+        TextureLoaderWrapper loader(TextureLoader(ctx.m_Archive));
+        BoardView view(loader, ctx);
+        Board board;
+        SetupBoard(board);
+        board.Set(7, 7, Piece::WhiteQueen);
+
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Frames; ++i) {
+                ctx.Clear(Color::DarkGray);
+                view.Draw(ctx, board, 0, 0);
+                ctx.Update();
+            }
+        });
+        return BenchSample{ns, Frames};
+    }});
+
+    // Many sprites from one atlas page, which the batch merges into one call.
+    benchmarks.push_back({"SpriteBatch/Draw", [&ctx]() {
+        static constexpr Dimension Frames = 100;
+        static constexpr Dimension Sprites = 1000;
+
+        TextureLoader loader(ctx.m_Archive);
+        Texture& texture = loader.Get("WhiteQueen.png", ctx);
+
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Frames; ++i) {
+                ctx.Clear(Color::DarkGray);
+                for(Dimension j = 0; j < Sprites; ++j) {
+                    texture.Draw(ctx, (j * 37) % Context::Width, (j * 53) % Context::Height, Board::SquareScale / 2, Board::SquareScale / 2);
+                }
+                ctx.Update();
+            }
+        });
+        return BenchSample{ns, Frames * Sprites};
+    }});
+
+    // A piece moving every frame, so each frame redraws two cells.
+    benchmarks.push_back({"BoardView/Move", [&ctx]() {
+        static constexpr Dimension Frames = 100;
+
+        TextureLoaderWrapper loader(TextureLoader(ctx.m_Archive));
+        BoardView view(loader, ctx);
+        Board board;
+        SetupBoard(board);
+
+        double ns = Time([&]() {
+            for(Dimension i = 0; i < Frames; ++i) {
+                board.Set(i % Board::Width, 7, Piece::None);
+                board.Set((i + 1) % Board::Width, 7, Piece::WhiteQueen);
+                ctx.Clear(Color::DarkGray);
+                view.Draw(ctx, board, 0, 0);
+                ctx.Update();
+            }
+        });
+        return BenchSample{ns, Frames};
+    }});
+}
+
+static BenchResult Run(const Benchmark& benchmark, const BenchSettings& settings) {
+    benchmark.m_Run();
+    TimedAllocations = {};
+
+    std::vector<BenchSample> samples;
+    for(Dimension i = 0; i < settings.m_Repetitions; ++i) samples.push_back(benchmark.m_Run());
+
+    std::uint64_t operations = 0;
+    for(const BenchSample& sample : samples) operations += sample.m_Operations;
+    double allocations = static_cast<double>(TimedAllocations.m_Count) / static_cast<double>(std::max<std::uint64_t>(operations, 1));
+
+    std::vector<double> per_op;
+    for(const BenchSample& sample : samples) per_op.push_back(sample.m_Nanoseconds / static_cast<double>(std::max<std::uint64_t>(sample.m_Operations, 1)));
+    std::nth_element(per_op.begin(), per_op.begin() + per_op.size() / 2, per_op.end());
+
+    return {benchmark.m_Name, per_op[per_op.size() / 2], samples.front().m_Operations, allocations};
+}
+
+static void WriteJSON(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    if(!out) throw std::runtime_error("Failed to open " + path);
+
+    out << "{\n  \"benchmarks\": [\n";
+    for(std::size_t i = 0; i < results.size(); ++i) {
+        out << "    {\"name\": \"" << results[i].m_Name << "\", \"relative\": " << results[i].m_Relative
+            << ", \"ns_per_op\": " << results[i].m_NanosecondsPerOp << ", \"operations\": " << results[i].m_Operations;
+        if(Profiler::TracksAllocations) out << ", \"allocations_per_op\": " << results[i].m_AllocationsPerOp;
+        out << '}' << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+
+    if(!out) throw std::runtime_error("Failed to write " + path);
+}
+
+// Reads back the relative times WriteJSON produces; this is not a general
+// JSON parser.
+static std::unordered_map<std::string, double> ReadBaseline(const std::string& path) {
+    std::ifstream in(path);
+    if(!in) throw std::runtime_error("Failed to open baseline " + path);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    static constexpr const char NameKey[] = "\"name\": \"";
+    static constexpr const char TimeKey[] = "\"relative\": ";
+
+    std::unordered_map<std::string, double> baseline;
+    for(std::size_t at = text.find(NameKey); at != std::string::npos; at = text.find(NameKey, at)) {
+        std::size_t begin = at + sizeof(NameKey) - 1;
+        std::size_t end = text.find('"', begin);
+        std::size_t time = text.find(TimeKey, end);
+        if(end == std::string::npos || time == std::string::npos) throw std::runtime_error("Malformed baseline " + path);
+
+        baseline[text.substr(begin, end - begin)] = std::stod(text.substr(time + sizeof(TimeKey) - 1));
+        at = time;
+    }
+
+    return baseline;
+}
+
+static BenchSettings ParseArguments(Span<char*> args) {
+    BenchSettings settings{};
+    for(Dimension i = 0; i < args.m_Size; ++i) {
+        std::string arg{args.m_Data[i]};
+        if(arg == "--no-render") {
+            settings.m_Render = false;
+            continue;
+        }
+        if(i + 1 >= args.m_Size) throw std::runtime_error("Missing value for " + arg);
+
+        std::string value{args.m_Data[++i]};
+        if(arg == "--repetitions") settings.m_Repetitions = std::max(std::stoi(value), 1);
+        else if(arg == "--tolerance") settings.m_Tolerance = std::stod(value);
+        else if(arg == "--filter") settings.m_Filter = value;
+        else if(arg == "--json") settings.m_JSON = value;
+        else if(arg == "--baseline") settings.m_Baseline = value;
+        else throw std::runtime_error("Unknown option " + arg);
+    }
+
+    return settings;
+}
+
+// Exit status: 0 on success, 1 on error, 2 if any benchmark regressed
+// beyond the tolerance against the baseline. Steady-state allocations are
+// gated by CWGAllocationTest instead.
+int main(int argc, char** argv) {
+    try {
+        std::vector<char*> args(argv + 1, argv + argc);
+        BenchSettings settings = ParseArguments(Span<char*>(args));
+
+        Board::SetDimensions(8, 8);
+
+        std::vector<Benchmark> benchmarks{
+            Calibration(),
+            EnumeratePositions(Piece::WhitePawn, "Pawn"),
+            EnumeratePositions(Piece::WhiteRook, "Rook"),
+            EnumeratePositions(Piece::WhiteBishop, "Bishop"),
+            EnumeratePositions(Piece::WhiteKnight, "Knight"),
+            EnumeratePositions(Piece::WhiteKing, "King"),
+            EnumeratePositions(Piece::WhiteQueen, "Queen"),
+            ProjectileStep(10),
+            ProjectileStep(1000),
+            ProjectileStep(100000),
+            MatchThroughput(),
+            MatchSteadyState()
+        };
+
+        std::unique_ptr<Context> ctx;
+        if(settings.m_Render) {
+            Context::Width = 640;
+            Context::Height = 480;
+            ctx = std::make_unique<Context>(true);
+            AddRenderBenchmarks(benchmarks, *ctx);
+        }
+
+        std::unordered_map<std::string, double> baseline;
+        if(!settings.m_Baseline.empty()) baseline = ReadBaseline(settings.m_Baseline);
+
+        std::vector<BenchResult> results;
+        bool regressed = false;
+        double unit = 0.0;
+        std::printf("%-32s %14s %10s %10s %12s\n", "Benchmark", "ns/op", "Relative", "Change", "allocs/op");
+        for(const Benchmark& benchmark : benchmarks) {
+            // The calibration always runs, since every other result needs it.
+            bool calibration = unit == 0.0;
+            if(!calibration && benchmark.m_Name.find(settings.m_Filter) == std::string::npos) continue;
+
+            BenchResult result = Run(benchmark, settings);
+            if(calibration) unit = result.m_NanosecondsPerOp;
+            result.m_Relative = result.m_NanosecondsPerOp / unit;
+            results.push_back(result);
+
+            char allocations[32] = "-";
+            if(Profiler::TracksAllocations) std::snprintf(allocations, sizeof(allocations), "%.3f", result.m_AllocationsPerOp);
+
+            char change_text[32] = "-";
+            bool slower = false;
+            auto base = baseline.find(result.m_Name);
+            if(base != baseline.end()) {
+                double change = result.m_Relative / base->second - 1.0;
+                slower = change > settings.m_Tolerance;
+                std::snprintf(change_text, sizeof(change_text), "%+.1f%%", change * 100.0);
+            }
+            regressed = regressed || slower;
+
+            std::printf("%-32s %14.1f %10.2f %10s %12s%s\n", result.m_Name.c_str(), result.m_NanosecondsPerOp, result.m_Relative, change_text, allocations, slower ? "  REGRESSION" : "");
+        }
+
+        if(!settings.m_JSON.empty()) WriteJSON(settings.m_JSON, results);
+        return regressed ? 2 : 0;
+    }
+    catch(const std::exception& e) {
+        std::fprintf(stderr, "CWGBench: %s\n", e.what());
+        return 1;
+    }
+}
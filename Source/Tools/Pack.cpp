@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Util.hpp>
+#include <FX.hpp>
+#include <Archive.hpp>
+
+static constexpr Dimension PageSize = 1024;
+static constexpr Dimension Padding = 1;
+static constexpr Dimension SolidSize = 4;
+
+struct PackedImage {
+    std::string m_Name;
+    SDL_Surface* m_Surface;
+    Dimension m_Page;
+    SDL_Rect m_Rect;
+};
+
+struct PackedEntry {
+    ArchiveEntry m_Entry;
+    std::vector<std::byte> m_Payload;
+};
+
+static SDL_Surface* NewPage() {
+    SDL_Surface* page = SDL_CreateSurface(PageSize, PageSize, SDL_PIXELFORMAT_RGBA32);
+    SDLNullCheck(page);
+    SDLResultCheck(SDL_FillSurfaceRect(page, nullptr, 0));
+    return page;
+}
+
+static ArchiveEntry MakeEntry(const std::string& name, ArchiveKind kind) {
+    if(name.size() >= ArchiveEntry::NameSize) throw std::runtime_error("Resource name too long for the archive: " + name);
+
+    ArchiveEntry entry{};
+    std::copy(name.begin(), name.end(), entry.m_Name);
+    entry.m_Kind = kind;
+    return entry;
+}
+
+static ArchiveEntry RegionEntry(const std::string& name, ArchiveKind kind, Dimension page, const SDL_Rect& rect) {
+    ArchiveEntry entry = MakeEntry(name, kind);
+    entry.m_Page = page;
+    entry.m_X = rect.x;
+    entry.m_Y = rect.y;
+    entry.m_Width = rect.w;
+    entry.m_Height = rect.h;
+    return entry;
+}
+
+static void PackImages(std::vector<PackedEntry>& entries, Span<const std::string> inputs) {
+    std::vector<PackedImage> images;
+    for(const std::string& input : inputs) {
+        SDL_Surface* loaded = IMG_Load(input.c_str());
+        SDLNullCheck(loaded);
+        SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(loaded);
+        SDLNullCheck(surface);
+
+        if(surface->w + 2 * Padding > PageSize || surface->h + 2 * Padding > PageSize) throw std::runtime_error("Image too large for an atlas page: " + input);
+        images.push_back({std::filesystem::path(input).filename().string(), surface, 0, {}});
+    }
+
+    std::sort(images.begin(), images.end(), [](const PackedImage& a, const PackedImage& b) { return a.m_Surface->h > b.m_Surface->h; });
+
+    std::vector<SDL_Surface*> pages{NewPage()};
+
+    SDL_Rect solid {Padding, Padding, SolidSize, SolidSize};
+    SDLResultCheck(SDL_FillSurfaceRect(pages[0], &solid, 0xFFFFFFFF));
+    SDL_Rect solid_centre {solid.x + 1, solid.y + 1, SolidSize - 2, SolidSize - 2};
+
+    Dimension x = solid.x + solid.w + Padding;
+    Dimension y = 0;
+    Dimension shelf = solid.h + 2 * Padding;
+
+    for(auto& image : images) {
+        Dimension w = image.m_Surface->w + 2 * Padding;
+        Dimension h = image.m_Surface->h + 2 * Padding;
+
+        if(x + w > PageSize) {
+            x = 0;
+            y += shelf;
+            shelf = 0;
+        }
+        if(y + h > PageSize) {
+            pages.push_back(NewPage());
+            x = 0;
+            y = 0;
+            shelf = 0;
+        }
+
+        image.m_Page = static_cast<Dimension>(pages.size()) - 1;
+        image.m_Rect = {x + Padding, y + Padding, image.m_Surface->w, image.m_Surface->h};
+        SDLResultCheck(SDL_SetSurfaceBlendMode(image.m_Surface, SDL_BLENDMODE_NONE));
+        SDLResultCheck(SDL_BlitSurface(image.m_Surface, nullptr, pages.back(), &image.m_Rect));
+
+        x += w;
+        shelf = std::max(shelf, h);
+        SDL_DestroySurface(image.m_Surface);
+    }
+
+    for(Dimension i = 0; i < pages.size(); ++i) {
+        SDL_Surface* page = pages[i];
+        PackedEntry packed{MakeEntry("Page" + std::to_string(i), ArchiveKind::AtlasPage), {}};
+        packed.m_Entry.m_Page = i;
+        packed.m_Entry.m_Width = page->w;
+        packed.m_Entry.m_Height = page->h;
+
+        Dimension row = page->w * 4;
+        packed.m_Payload.resize(static_cast<std::size_t>(row) * page->h);
+        for(Dimension j = 0; j < page->h; ++j) {
+            auto source = static_cast<const std::byte*>(page->pixels) + static_cast<std::size_t>(j) * page->pitch;
+            std::copy(source, source + row, packed.m_Payload.data() + static_cast<std::size_t>(j) * row);
+        }
+
+        entries.push_back(std::move(packed));
+        SDL_DestroySurface(page);
+    }
+
+    for(auto& image : images) entries.push_back({RegionEntry(image.m_Name, ArchiveKind::Sprite, image.m_Page, image.m_Rect), {}});
+    entries.push_back({RegionEntry("Solid", ArchiveKind::Solid, 0, solid_centre), {}});
+}
+
+// Mix_LoadWAV converts to the opened device format, so the stored PCM can be
+// played directly as long as the game opens audio with the same parameters.
+static void PackSounds(std::vector<PackedEntry>& entries, Span<const std::string> inputs) {
+    for(const std::string& input : inputs) {
+        Mix_Chunk* chunk = Mix_LoadWAV(input.c_str());
+        SDLNullCheck(chunk);
+
+        PackedEntry packed{MakeEntry(std::filesystem::path(input).filename().string(), ArchiveKind::Sound), {}};
+        auto samples = reinterpret_cast<const std::byte*>(chunk->abuf);
+        packed.m_Payload.assign(samples, samples + chunk->alen);
+        packed.m_Entry.m_Size = chunk->alen;
+
+        entries.push_back(std::move(packed));
+        Mix_FreeChunk(chunk);
+    }
+}
+
+static void Write(const std::string& output, std::vector<PackedEntry>& entries) {
+    ArchiveHeader header{};
+    std::copy(std::begin(Archive::Magic), std::end(Archive::Magic), header.m_Magic);
+    header.m_Version = Archive::Version;
+    header.m_EntryCount = static_cast<std::uint32_t>(entries.size());
+
+    int frequency{};
+    SDL_AudioFormat format{};
+    int channels{};
+    if(!Mix_QuerySpec(&frequency, &format, &channels)) throw std::runtime_error(SDL_GetError());
+    header.m_AudioFrequency = frequency;
+    header.m_AudioFormat = format;
+    header.m_AudioChannels = channels;
+
+    std::uint64_t offset = sizeof(ArchiveHeader) + sizeof(ArchiveEntry) * entries.size();
+    for(auto& packed : entries) {
+        if(packed.m_Payload.empty()) continue;
+
+        offset = (offset + Archive::PayloadAlignment - 1) / Archive::PayloadAlignment * Archive::PayloadAlignment;
+        packed.m_Entry.m_Offset = offset;
+        packed.m_Entry.m_Size = packed.m_Payload.size();
+        offset += packed.m_Payload.size();
+    }
+
+    std::ofstream out(output, std::ios::binary);
+    if(!out) throw std::runtime_error("Failed to open " + output);
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for(auto& packed : entries) out.write(reinterpret_cast<const char*>(&packed.m_Entry), sizeof(ArchiveEntry));
+
+    for(auto& packed : entries) {
+        if(packed.m_Payload.empty()) continue;
+
+        while(static_cast<std::uint64_t>(out.tellp()) < packed.m_Entry.m_Offset) out.put('\0');
+        out.write(reinterpret_cast<const char*>(packed.m_Payload.data()), static_cast<std::streamsize>(packed.m_Payload.size()));
+    }
+
+    if(!out) throw std::runtime_error("Failed to write " + output);
+}
+
+static void Pack(const std::string& output, Span<char*> inputs) {
+    std::vector<std::string> images;
+    std::vector<std::string> sounds;
+    for(char* input : inputs) {
+        std::string extension = std::filesystem::path(input).extension().string();
+        if(extension == ".png") images.emplace_back(input);
+        else if(extension == ".wav") sounds.emplace_back(input);
+        else throw std::runtime_error(std::string("Unsupported resource type: ") + input);
+    }
+
+    std::vector<PackedEntry> entries;
+    PackImages(entries, Span<const std::string>(images));
+    PackSounds(entries, Span<const std::string>(sounds));
+    Write(output, entries);
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) {
+        std::fprintf(stderr, "Usage: CWGPack <output.cwga> <resource.png|resource.wav>...\n");
+        return 1;
+    }
+
+    std::vector<char*> inputs(argv + 2, argv + argc);
+    try {
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        SDLResultCheck(SDL_Init(SDL_INIT_AUDIO));
+        SDLResultCheck(Mix_OpenAudio(MIX_DEFAULT_FREQUENCY, MIX_DEFAULT_FORMAT, MIX_DEFAULT_CHANNELS, 4096));
+
+        Pack(argv[1], Span<char*>(inputs));
+
+        Mix_CloseAudio();
+        SDL_Quit();
+    }
+    catch(const std::exception& e) {
+        std::fprintf(stderr, "CWGPack: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2023 Emily "TTG" Banerjee <prs.ttg+cwg@pm.me>
+
+#include <Util.hpp>
+#include <CWG.hpp>
+#include <Match.hpp>
+#include <Random.hpp>
+#include <ThreadPool.hpp>
+
+static constexpr Dimension PieceKinds = 6;
+static constexpr Dimension WeaponKinds = 7;
+static constexpr Dimension Loadouts = PieceKinds * WeaponKinds;
+
+static constexpr std::array<const char*, PieceKinds> PieceNames{"Pawn", "Rook", "Bishop", "Knight", "King", "Queen"};
+static constexpr std::array<const char*, WeaponKinds> WeaponNames{"None", "Grenade", "Pistol", "Shotgun", "ScienceGun", "Rifle", "RocketLauncher"};
+
+struct TournamentSettings {
+    Dimension m_Matches{10};
+    Dimension m_Threads{};
+    Dimension m_MaxTicks{20000};
+    Dimension m_Width{8};
+    Dimension m_Height{8};
+    std::uint64_t m_Seed{1};
+    AIStrength m_Strength{AIStrength::Random};
+    std::string m_CSV;
+    std::string m_JSON;
+};
+
+// One pairing of a white loadout against a black loadout.
+struct PairingResult {
+    Dimension m_WhiteWins{};
+    Dimension m_BlackWins{};
+    Dimension m_Draws{};
+    std::uint64_t m_Ticks{};
+    MatchStats m_Stats{};
+};
+
+struct WeaponTotals {
+    Dimension m_Matches{};
+    Dimension m_Wins{};
+    std::uint64_t m_Shots{};
+    std::uint64_t m_Hits{};
+    double m_Damage{};
+};
+
+static Piece WhitePiece(Dimension loadout) {
+    return static_cast<Piece>(static_cast<Dimension>(Piece::WhitePawn) + loadout / WeaponKinds);
+}
+
+static Piece BlackPiece(Dimension loadout) {
+    return static_cast<Piece>(static_cast<Dimension>(Piece::BlackPawn) + loadout / WeaponKinds);
+}
+
+static Weapon LoadoutWeapon(Dimension loadout) {
+    return static_cast<Weapon>(loadout % WeaponKinds);
+}
+
+static std::string LoadoutName(Dimension loadout) {
+    return std::string(PieceNames[loadout / WeaponKinds]) + "/" + WeaponNames[loadout % WeaponKinds];
+}
+
+// Seeds depend only on the pairing and match index, so results do not
+// change with the thread count.
+static std::uint64_t MatchSeed(const TournamentSettings& settings, Dimension pairing, Dimension index) {
+    std::uint64_t state = settings.m_Seed ^ (static_cast<std::uint64_t>(pairing) << 32 | static_cast<std::uint64_t>(index));
+    return Random::SplitMix64(state);
+}
+
+static PairingResult RunPairing(const TournamentSettings& settings, Dimension pairing) {
+    Dimension white = pairing / Loadouts;
+    Dimension black = pairing % Loadouts;
+
+    GameSettings game{};
+    game.m_MoveTimer = false;
+    game.m_WhitePiece = WhitePiece(white);
+    game.m_WhiteWeapon = LoadoutWeapon(white);
+    game.m_WhiteAI = settings.m_Strength;
+    game.m_BlackPiece = BlackPiece(black);
+    game.m_BlackWeapon = LoadoutWeapon(black);
+    game.m_BlackAI = settings.m_Strength;
+
+    PairingResult result{};
+    for(Dimension i = 0; i < settings.m_Matches; ++i) {
+        Match match(game, MatchSeed(settings, pairing, i));
+
+        TickResult tick{};
+        while(!tick.m_Over && match.m_Tick < settings.m_MaxTicks) tick = match.Tick({});
+
+        if(!tick.m_Over) result.m_Draws++;
+        else if(tick.m_Winner == 0) result.m_WhiteWins++;
+        else result.m_BlackWins++;
+
+        result.m_Ticks += match.m_Tick;
+        for(Dimension side = 0; side < 2; ++side) {
+            result.m_Stats.m_Shots[side] += match.m_Stats.m_Shots[side];
+            result.m_Stats.m_Hits[side] += match.m_Stats.m_Hits[side];
+            result.m_Stats.m_Damage[side] += match.m_Stats.m_Damage[side];
+        }
+    }
+
+    return result;
+}
+
+static std::array<WeaponTotals, WeaponKinds> TotalWeapons(const std::vector<PairingResult>& results) {
+    std::array<WeaponTotals, WeaponKinds> totals{};
+    for(std::size_t pairing = 0; pairing < results.size(); ++pairing) {
+        const PairingResult& result = results[pairing];
+        std::array<Dimension, 2> loadouts{static_cast<Dimension>(pairing / Loadouts), static_cast<Dimension>(pairing % Loadouts)};
+        std::array<Dimension, 2> wins{result.m_WhiteWins, result.m_BlackWins};
+
+        for(Dimension side = 0; side < 2; ++side) {
+            WeaponTotals& total = totals[loadouts[side] % WeaponKinds];
+            total.m_Matches += result.m_WhiteWins + result.m_BlackWins + result.m_Draws;
+            total.m_Wins += wins[side];
+            total.m_Shots += result.m_Stats.m_Shots[side];
+            total.m_Hits += result.m_Stats.m_Hits[side];
+            total.m_Damage += result.m_Stats.m_Damage[side];
+        }
+    }
+
+    return totals;
+}
+
+static double Ratio(double numerator, double denominator) {
+    return denominator > 0.0 ? numerator / denominator : 0.0;
+}
+
+static void WriteCSV(const std::string& prefix, const std::vector<PairingResult>& results, const std::array<WeaponTotals, WeaponKinds>& weapons) {
+    std::ofstream matrix(prefix + "Matrix.csv");
+    if(!matrix) throw std::runtime_error("Failed to open " + prefix + "Matrix.csv");
+
+    matrix << "white_piece,white_weapon,black_piece,black_weapon,matches,white_wins,black_wins,draws,white_win_rate,mean_ticks\n";
+    for(std::size_t pairing = 0; pairing < results.size(); ++pairing) {
+        const PairingResult& result = results[pairing];
+        auto white = static_cast<Dimension>(pairing / Loadouts);
+        auto black = static_cast<Dimension>(pairing % Loadouts);
+        Dimension matches = result.m_WhiteWins + result.m_BlackWins + result.m_Draws;
+
+        matrix << PieceNames[white / WeaponKinds] << ',' << WeaponNames[white % WeaponKinds] << ','
+               << PieceNames[black / WeaponKinds] << ',' << WeaponNames[black % WeaponKinds] << ','
+               << matches << ',' << result.m_WhiteWins << ',' << result.m_BlackWins << ',' << result.m_Draws << ','
+               << Ratio(result.m_WhiteWins, matches) << ',' << Ratio(static_cast<double>(result.m_Ticks), matches) << '\n';
+    }
+
+    std::ofstream table(prefix + "Weapons.csv");
+    if(!table) throw std::runtime_error("Failed to open " + prefix + "Weapons.csv");
+
+    table << "weapon,matches,win_rate,shots,hits,hits_per_shot,damage,damage_per_shot,damage_per_match\n";
+    for(Dimension weapon = 0; weapon < WeaponKinds; ++weapon) {
+        const WeaponTotals& total = weapons[weapon];
+        table << WeaponNames[weapon] << ',' << total.m_Matches << ',' << Ratio(total.m_Wins, total.m_Matches) << ','
+              << total.m_Shots << ',' << total.m_Hits << ',' << Ratio(static_cast<double>(total.m_Hits), static_cast<double>(total.m_Shots)) << ','
+              << total.m_Damage << ',' << Ratio(total.m_Damage, static_cast<double>(total.m_Shots)) << ',' << Ratio(total.m_Damage, total.m_Matches) << '\n';
+    }
+}
+
+static void WriteJSON(const std::string& path, const TournamentSettings& settings, const std::vector<PairingResult>& results, const std::array<WeaponTotals, WeaponKinds>& weapons) {
+    std::ofstream out(path);
+    if(!out) throw std::runtime_error("Failed to open " + path);
+
+    out << "{\n  \"matches_per_pairing\": " << settings.m_Matches << ",\n  \"seed\": " << settings.m_Seed
+        << ",\n  \"width\": " << settings.m_Width << ",\n  \"height\": " << settings.m_Height << ",\n  \"loadouts\": [";
+    for(Dimension loadout = 0; loadout < Loadouts; ++loadout) out << (loadout ? ", " : "") << '"' << LoadoutName(loadout) << '"';
+
+    // Rows are the white loadout, columns the black one.
+    out << "],\n  \"white_win_rate\": [\n";
+    for(Dimension white = 0; white < Loadouts; ++white) {
+        out << "    [";
+        for(Dimension black = 0; black < Loadouts; ++black) {
+            const PairingResult& result = results[white * Loadouts + black];
+            out << (black ? ", " : "") << Ratio(result.m_WhiteWins, result.m_WhiteWins + result.m_BlackWins + result.m_Draws);
+        }
+        out << (white + 1 < Loadouts ? "],\n" : "]\n");
+    }
+
+    out << "  ],\n  \"weapons\": [\n";
+    for(Dimension weapon = 0; weapon < WeaponKinds; ++weapon) {
+        const WeaponTotals& total = weapons[weapon];
+        out << "    {\"weapon\": \"" << WeaponNames[weapon] << "\", \"matches\": " << total.m_Matches
+            << ", \"win_rate\": " << Ratio(total.m_Wins, total.m_Matches) << ", \"shots\": " << total.m_Shots
+            << ", \"hits\": " << total.m_Hits << ", \"damage\": " << total.m_Damage
+            << ", \"damage_per_shot\": " << Ratio(total.m_Damage, static_cast<double>(total.m_Shots)) << '}'
+            << (weapon + 1 < WeaponKinds ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+
+    if(!out) throw std::runtime_error("Failed to write " + path);
+}
+
+static AIStrength ParseStrength(const std::string& name) {
+    if(name == "random") return AIStrength::Random;
+    if(name == "easy") return AIStrength::Easy;
+    if(name == "normal") return AIStrength::Normal;
+    if(name == "hard") return AIStrength::Hard;
+    throw std::runtime_error("Unknown AI strength " + name);
+}
+
+static TournamentSettings ParseArguments(Span<char*> args) {
+    TournamentSettings settings{};
+    for(Dimension i = 0; i < args.m_Size; ++i) {
+        std::string arg{args.m_Data[i]};
+        if(i + 1 >= args.m_Size) throw std::runtime_error("Missing value for " + arg);
+
+        std::string value{args.m_Data[++i]};
+        if(arg == "--matches") settings.m_Matches = std::stoi(value);
+        else if(arg == "--threads") settings.m_Threads = std::stoi(value);
+        else if(arg == "--max-ticks") settings.m_MaxTicks = std::stoi(value);
+        else if(arg == "--width") settings.m_Width = std::stoi(value);
+        else if(arg == "--height") settings.m_Height = std::stoi(value);
+        else if(arg == "--seed") settings.m_Seed = std::stoull(value);
+        else if(arg == "--ai") settings.m_Strength = ParseStrength(value);
+        else if(arg == "--csv") settings.m_CSV = value;
+        else if(arg == "--json") settings.m_JSON = value;
+        else throw std::runtime_error("Unknown option " + arg);
+    }
+
+    return settings;
+}
+
+int main(int argc, char** argv) {
+    try {
+        std::vector<char*> args(argv + 1, argv + argc);
+        TournamentSettings settings = ParseArguments(Span<char*>(args));
+
+        // Board dimensions and move tables are global, so they are fixed before any match starts.
+        Board::SetDimensions(settings.m_Width, settings.m_Height);
+
+        ThreadPool pool(settings.m_Threads);
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::future<PairingResult>> pending;
+        pending.reserve(Loadouts * Loadouts);
+        for(Dimension pairing = 0; pairing < Loadouts * Loadouts; ++pairing) {
+            pending.push_back(pool.Submit([&settings, pairing]() { return RunPairing(settings, pairing); }));
+        }
+
+        std::vector<PairingResult> results;
+        results.reserve(pending.size());
+        for(auto& future : pending) results.push_back(future.get());
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::array<WeaponTotals, WeaponKinds> weapons = TotalWeapons(results);
+
+        std::printf("%d matches on %d threads in %.2f s\n", Loadouts * Loadouts * settings.m_Matches, pool.Size(), seconds);
+        std::printf("%-16s %8s %9s %9s %12s\n", "Weapon", "Win rate", "Hits/shot", "Dmg/shot", "Dmg/match");
+        for(Dimension weapon = 0; weapon < WeaponKinds; ++weapon) {
+            const WeaponTotals& total = weapons[weapon];
+            std::printf("%-16s %8.3f %9.3f %9.2f %12.2f\n", WeaponNames[weapon], Ratio(total.m_Wins, total.m_Matches),
+                        Ratio(static_cast<double>(total.m_Hits), static_cast<double>(total.m_Shots)),
+                        Ratio(total.m_Damage, static_cast<double>(total.m_Shots)), Ratio(total.m_Damage, total.m_Matches));
+        }
+
+        if(!settings.m_CSV.empty()) WriteCSV(settings.m_CSV, results, weapons);
+        if(!settings.m_JSON.empty()) WriteJSON(settings.m_JSON, settings, results, weapons);
+    }
+    catch(const std::exception& e) {
+        std::fprintf(stderr, "CWGTournament: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}